@@ -0,0 +1,125 @@
+// Hardware interface implementation rendering into an in-memory framebuffer, for the host
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "emulator.h"
+
+Emulator_hw::Emulator_hw(Print *frameOut, EmulatorOutput format, const CBCPEvent *event, Print *debugOut) :
+        frameOut_(frameOut), format_(format), event_(event), debugOut_(debugOut),
+        leds_{}, screens_(leds_, FramebufferXY::table.xy) {
+    screens_.begin(debugOut);
+}
+
+// ---- Hw interface ----
+
+void Emulator_hw::splashScreen(bool showProgress) {
+    screens_.showSplashScreen(showProgress);
+}
+
+bool Emulator_hw::ensureConnection() {
+    return true;
+}
+
+void Emulator_hw::configServerMsg(const char *msg) {
+    screens_.showConfigServerMsg(msg, true);
+}
+
+void Emulator_hw::reboot() {
+    debugPrintln("Reboot");
+    displayState = DISPLAY_BOOT;
+    splashScreen();
+}
+
+void Emulator_hw::displayEventName(const CBCPEvent& event) {
+    displayEventName(event.name().c_str());
+}
+
+void Emulator_hw::displayEventName(const char *name) {
+    displayState = DISPLAY_EVENT_NAME;
+    screens_.showEventName(name);
+}
+
+void Emulator_hw::displayEventRound(const CBCPEvent& event) {
+    displayEventRound(event.currentRound());
+}
+
+void Emulator_hw::displayEventRound(int round) {
+    displayState = DISPLAY_EVENT_ROUND;
+    screens_.showEventRound(round);
+}
+
+void Emulator_hw::displayCountdown(long remaining, uint32_t timerLength, bool paused, int currentRound, int totalRounds, time_t now) {
+    displayState = DISPLAY_EVENT_COUNTDOWN;
+    screens_.showCountdown(remaining, timerLength, paused, currentRound, totalRounds, now);
+}
+
+// ---- Render loop ----
+
+void Emulator_hw::tick() {
+    struct timeval now;
+    if (event_ != nullptr && displayState == DISPLAY_EVENT_COUNTDOWN && secondTick(screens_.tickSecond, now)) {
+        screens_.showCountdown(*event_, now.tv_sec);
+    }
+    frame(millis());
+}
+
+bool Emulator_hw::frame(uint32_t now) {
+    setMillis(now);
+    if (!screens_.frame(now)) {
+        return false;
+    }
+    if (frameOut_ != nullptr) {
+        if (format_ == EMULATOR_ANSI) {
+            writeANSI(frameOut_);
+        } else if (format_ == EMULATOR_PPM) {
+            writePPM(frameOut_);
+        }
+    }
+    return true;
+}
+
+// ---- Framebuffer ----
+
+uint32_t Emulator_hw::checksum() const {
+    uint32_t hash = 2166136261UL;
+    const uint8_t *bytes = (const uint8_t *) leds_;
+    for (size_t i = 0; i < sizeof(leds_); i++) {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+// Two terminal columns per pixel, so the pixels come out about square
+void Emulator_hw::writeANSI(Print *out) {
+    if (framesWritten_) {
+        out->print("\x1b[" + String(height) + "F"); // back to the top of the previous frame
+    }
+    framesWritten_ = true;
+    for (int16_t y = 0; y < height; y++) {
+        for (int16_t x = 0; x < width; x++) {
+            const CRGB &c = leds_[y * width + x];
+            out->print("\x1b[48;2;" + String(c.r) + ";" + String(c.g) + ";" + String(c.b) + "m  ");
+        }
+        out->print("\x1b[0m\n");
+    }
+}
+
+void Emulator_hw::writePPM(Print *out) const {
+    out->print("P6\n" + String(width) + " " + String(height) + "\n255\n");
+    out->write((const uint8_t *) leds_, sizeof(leds_));
+}
+
+// ---- Print interface ----
+
+size_t Emulator_hw::write(uint8_t c) {
+    if (c == '\n' || bufferIndex_ >= sizeof(buffer_) - 1) {
+        buffer_[bufferIndex_] = '\0';
+        screens_.showPrintLine(buffer_);
+        bufferIndex_ = 0;
+
+    } else if (c != '\r' && bufferIndex_ < sizeof(buffer_) - 2) {
+        buffer_[bufferIndex_++] = c;
+
+    }
+    return 1;
+}
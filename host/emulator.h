@@ -0,0 +1,90 @@
+// Hardware interface implementation rendering into an in-memory framebuffer, for the host
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <hw.h>
+#include <screens.h>
+#include <Arduino.h>
+#include <Print.h>
+
+#include <FastLED.h>
+#include <xymap.h>
+
+enum EmulatorOutput : uint8_t {
+    EMULATOR_NONE,  // frames kept in the framebuffer only
+    EMULATOR_ANSI,  // truecolor blocks, each frame drawn over the previous one in the terminal
+    EMULATOR_PPM    // binary PPM (P6) per frame, one after another
+};
+
+// The screens of the TC001, drawn by the same Screens code, composed into a row-major CRGB
+// framebuffer instead of LEDs. Nothing runs in the background: everything is drawn right
+// away by the caller, and the render loop is stepped by frame(now), which also sets the
+// host clock (millis()) animations are started by, so frames are reproducible for any
+// given time. Frames changed are written to frameOut, if any, and can be compared by
+// checksum(). The countdown ticks from the event given by tick(), on the host it is drawn
+// by displayCountdown() with the timer data directly.
+class Emulator_hw : public Hw, public Print {
+public:
+    Emulator_hw(Print *frameOut = nullptr, EmulatorOutput format = EMULATOR_ANSI, const CBCPEvent *event = nullptr, Print *debugOut = nullptr);
+
+// ---- Hw interface ----
+    virtual void splashScreen(bool showProgress = true) override;
+    virtual bool ensureConnection() override;   // no network, always connected
+
+    virtual void displayEventName(const CBCPEvent& event) override;
+    virtual void displayEventRound(const CBCPEvent& event) override;
+
+    virtual void tick() override;
+
+    virtual void configServerMsg(const char *msg) override;
+
+    virtual void reboot() override;             // back to the boot screen
+
+// ---- Screens by their data, so no BCP event is needed ----
+    void displayEventName(const char *name);
+    void displayEventRound(int round);
+    // remaining seconds of the round (or of the pause), now only blinks the paused timer
+    void displayCountdown(long remaining, uint32_t timerLength, bool paused, int currentRound, int totalRounds, time_t now);
+    void setThresholds(long yellow, long red) { screens_.setThresholds(yellow, red); }
+    void setOvertimeEffect(EffectType type) { screens_.setOvertimeEffect(type); }
+    void setEffect(EffectType type, bool textOnly = true) { screens_.setEffect(type, textOnly); }
+    void showOverlay(const char *msg) { screens_.showConfigServerMsg(msg, false); }
+
+// ---- Render loop and framebuffer ----
+    // Animations and rolls moved to the time given, composed into the framebuffer,
+    // returns true (and writes the frame out) if any pixel changed
+    bool frame(uint32_t now);
+
+    static constexpr int16_t width = Screens::width;
+    static constexpr int16_t height = Screens::height;
+    inline const CRGB *pixels() const { return leds_; }     // y * width + x
+    inline CRGB pixel(int16_t x, int16_t y) const { return leds_[y * width + x]; }
+    uint32_t checksum() const;  // FNV-1a of the framebuffer
+    void writeANSI(Print *out);
+    void writePPM(Print *out) const;
+
+// ---- Print interface, status lines as on the TC001 ----
+    size_t write(uint8_t c) override;
+
+private:
+    typedef XYMap<width, height, NEO_MATRIX_TOP + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS + NEO_MATRIX_PROGRESSIVE> FramebufferXY;
+
+    Print *frameOut_;
+    EmulatorOutput format_;
+    const CBCPEvent *event_;
+    Print *debugOut_;
+    void debugPrintln(const String& msg) {
+        if (debugOut_ != nullptr) {
+            debugOut_->println("[Emulator_hw] " + msg);
+        }
+    }
+
+    CRGB leds_[FramebufferXY::size];
+    Screens screens_;
+    bool framesWritten_ = false;
+
+    char buffer_[256];
+    size_t bufferIndex_ = 0;
+};
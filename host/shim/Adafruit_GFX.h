@@ -0,0 +1,109 @@
+// Host shim of the Adafruit GFX library, the primitives the layers build on
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include "gfxfont.h"
+
+class Adafruit_GFX : public Print {
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void startWrite() {}
+    virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { fillRect(x, y, w, h, color); }
+    virtual void endWrite() {}
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+        for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, color);
+    }
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+    }
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        for (int16_t i = x; i < x + w; i++) drawFastVLine(i, y, h, color);
+    }
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+    void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+    void setTextWrap(bool w) { wrap = w; }
+    void setTextSize(uint8_t s) { textsize_x = textsize_y = s; }
+    void setFont(const GFXfont *f = nullptr) { gfxFont = (GFXfont *) f; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+    uint8_t getRotation() const { return rotation; }
+    int16_t getCursorX() const { return cursor_x; }
+    int16_t getCursorY() const { return cursor_y; }
+
+    // 8-bit characters of the font set, as the library does
+    using Print::write;
+    size_t write(uint8_t c) override {
+        if (gfxFont == nullptr || c == '\r') {
+            return 1;
+        }
+        if (c == '\n') {
+            cursor_x = 0;
+            cursor_y += gfxFont->yAdvance;
+        } else if (c >= gfxFont->first && c <= gfxFont->last) {
+            const GFXglyph *glyph = gfxFont->glyph + (c - gfxFont->first);
+            const uint8_t *bitmap = gfxFont->bitmap + glyph->bitmapOffset;
+            uint8_t bits = 0, bit = 0;
+            startWrite();
+            for (uint8_t yy = 0; yy < glyph->height; yy++) {
+                for (uint8_t xx = 0; xx < glyph->width; xx++) {
+                    if (!(bit++ & 7)) bits = *bitmap++;
+                    if (bits & 0x80) writePixel(cursor_x + glyph->xOffset + xx, cursor_y + glyph->yOffset + yy, textcolor);
+                    bits <<= 1;
+                }
+            }
+            endWrite();
+            cursor_x += glyph->xAdvance;
+        }
+        return 1;
+    }
+
+protected:
+    int16_t WIDTH, HEIGHT, _width, _height;
+    int16_t cursor_x = 0, cursor_y = 0;
+    uint16_t textcolor = 0xFFFF, textbgcolor = 0xFFFF;
+    uint8_t textsize_x = 1, textsize_y = 1;
+    uint8_t rotation = 0;
+    bool wrap = true;
+    GFXfont *gfxFont = nullptr;
+};
+
+class GFXcanvas16 : public Adafruit_GFX {
+public:
+    GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+        buffer = (uint16_t *) calloc((size_t) w * h, sizeof(uint16_t));
+    }
+    ~GFXcanvas16() { free(buffer); }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (buffer != nullptr && x >= 0 && y >= 0 && x < _width && y < _height) {
+            buffer[x + y * WIDTH] = color;
+        }
+    }
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        for (int16_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+    }
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+        for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, color);
+    }
+    void fillScreen(uint16_t color) override {
+        if (buffer != nullptr) {
+            for (int32_t i = 0; i < (int32_t) WIDTH * HEIGHT; i++) buffer[i] = color;
+        }
+    }
+    uint16_t getPixel(int16_t x, int16_t y) const {
+        return (x < 0 || y < 0 || x >= _width || y >= _height) ? 0 : buffer[x + y * WIDTH];
+    }
+    uint16_t *getBuffer() const { return buffer; }
+
+protected:
+    uint16_t *buffer = nullptr;
+};
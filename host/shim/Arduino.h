@@ -0,0 +1,71 @@
+// Host shim of the Arduino core, just what the display code uses
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
+#include <string>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *) (addr))
+#define pgm_read_word(addr) (*(const uint16_t *) (addr))
+#define pgm_read_dword(addr) (*(const uint32_t *) (addr))
+#define pgm_read_pointer(addr) (*(void * const *) (addr))
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+#define IRAM_ATTR
+
+typedef bool boolean;
+
+// Monotonic time since start, unless set: once setMillis() is called, millis() returns
+// the value set, so animations run on the time the test or emulator steps them by.
+// micros() always runs, for benchmarks.
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void setMillis(unsigned long ms);
+
+class String {
+public:
+    String() {}
+    String(const char *s) : s_(s ? s : "") {}
+    String(const std::string& s) : s_(s) {}
+    String(char c) : s_(1, c) {}
+    String(int v) : s_(std::to_string(v)) {}
+    String(unsigned int v) : s_(std::to_string(v)) {}
+    String(long v) : s_(std::to_string(v)) {}
+    String(unsigned long v) : s_(std::to_string(v)) {}
+    String(float v, unsigned int decimals = 2);
+    String(double v, unsigned int decimals = 2) : String((float) v, decimals) {}
+
+    inline const char *c_str() const { return s_.c_str(); }
+    inline unsigned int length() const { return s_.size(); }
+    inline char operator[](unsigned int i) const { return s_[i]; }
+    inline bool operator==(const String& o) const { return s_ == o.s_; }
+    inline bool operator!=(const String& o) const { return s_ != o.s_; }
+    inline String& operator+=(const String& o) { s_ += o.s_; return *this; }
+    inline String operator+(const String& o) const { return String(s_ + o.s_); }
+    friend inline String operator+(const char *a, const String& b) { return String(std::string(a) + b.s_); }
+
+private:
+    std::string s_;
+};
+
+#include "Print.h"
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud) {}
+    operator bool() const { return true; }
+    size_t write(uint8_t c) override { return fputc(c, stdout) != EOF; }
+    using Print::write;
+};
+extern HardwareSerial Serial;
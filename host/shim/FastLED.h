@@ -0,0 +1,81 @@
+// Host shim of FastLED, the color types and math the display code uses
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+
+typedef uint8_t fract8;
+
+inline uint8_t scale8(uint8_t i, fract8 scale) { return ((uint16_t) i * (1 + scale)) >> 8; }
+inline uint8_t scale8_video(uint8_t i, fract8 scale) { return (((uint16_t) i * scale) >> 8) + ((i && scale) ? 1 : 0); }
+inline uint8_t sin8(uint8_t theta) { return (uint8_t) lround(128 + 127 * sin(theta * 2 * M_PI / 256)); }
+
+struct CHSV {
+    uint8_t h, s, v;
+    constexpr CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB {
+    union {
+        struct { uint8_t r, g, b; };
+        uint8_t raw[3];
+    };
+    enum HTMLColorCode : uint32_t {
+        Black = 0x000000, White = 0xFFFFFF, Red = 0xFF0000, Green = 0x008000, Blue = 0x0000FF,
+        Yellow = 0xFFFF00, Magenta = 0xFF00FF, DeepSkyBlue = 0x00BFFF, Orange = 0xFFA500
+    };
+    constexpr CRGB() : r(0), g(0), b(0) {}
+    constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    constexpr CRGB(uint32_t c) : r((c >> 16) & 0xFF), g((c >> 8) & 0xFF), b(c & 0xFF) {}
+    constexpr CRGB(HTMLColorCode c) : CRGB((uint32_t) c) {}
+
+    CRGB& nscale8_video(uint8_t scale) {
+        r = scale8_video(r, scale);
+        g = scale8_video(g, scale);
+        b = scale8_video(b, scale);
+        return *this;
+    }
+    CRGB& nscale8(uint8_t scale) {
+        r = scale8(r, scale);
+        g = scale8(g, scale);
+        b = scale8(b, scale);
+        return *this;
+    }
+    explicit operator bool() const { return r || g || b; }
+    bool operator==(const CRGB& o) const { return r == o.r && g == o.g && b == o.b; }
+    bool operator!=(const CRGB& o) const { return !(*this == o); }
+};
+
+// Plain six sector HSV, not FastLED's rainbow tuned hues, good enough on the host
+inline void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+    uint8_t sector = hsv.h / 43, rest = (hsv.h - sector * 43) * 6;
+    uint8_t p = scale8(hsv.v, 255 - hsv.s),
+            q = scale8(hsv.v, 255 - scale8(hsv.s, rest)),
+            t = scale8(hsv.v, 255 - scale8(hsv.s, 255 - rest));
+    switch (sector) {
+        case 0: rgb = CRGB(hsv.v, t, p); break;
+        case 1: rgb = CRGB(q, hsv.v, p); break;
+        case 2: rgb = CRGB(p, hsv.v, t); break;
+        case 3: rgb = CRGB(p, q, hsv.v); break;
+        case 4: rgb = CRGB(t, p, hsv.v); break;
+        default: rgb = CRGB(hsv.v, p, q); break;
+    }
+}
+
+// Power model as FastLED's: mW per channel at full, plus the idle draw of each LED
+inline uint32_t calculate_unscaled_power_mW(const CRGB *leds, uint16_t count) {
+    uint32_t r = 0, g = 0, b = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        r += leds[i].r;
+        g += leds[i].g;
+        b += leds[i].b;
+    }
+    return ((r * 80) >> 8) + ((g * 55) >> 8) + ((b * 75) >> 8) + 5 * count;
+}
+
+inline uint8_t calculate_max_brightness_for_power_mW(const CRGB *leds, uint16_t count, uint8_t brightness, uint32_t maxMw) {
+    uint32_t requested = calculate_unscaled_power_mW(leds, count) * brightness / 256;
+    return requested <= maxMw ? brightness : (uint8_t) (brightness * maxMw / requested);
+}
@@ -0,0 +1,32 @@
+// Host shim of FastLED NeoMatrix, the layout flags XYMap is given by
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include <FastLED.h>
+
+#define NEO_MATRIX_TOP          0x00
+#define NEO_MATRIX_BOTTOM       0x01
+#define NEO_MATRIX_LEFT         0x00
+#define NEO_MATRIX_RIGHT        0x02
+#define NEO_MATRIX_CORNER       0x03
+#define NEO_MATRIX_ROWS         0x00
+#define NEO_MATRIX_COLUMNS      0x04
+#define NEO_MATRIX_AXIS         0x04
+#define NEO_MATRIX_PROGRESSIVE  0x00
+#define NEO_MATRIX_ZIGZAG       0x08
+#define NEO_MATRIX_SEQUENCE     0x08
+
+#define NEO_TILE_TOP            0x00
+#define NEO_TILE_BOTTOM         0x10
+#define NEO_TILE_LEFT           0x00
+#define NEO_TILE_RIGHT          0x20
+#define NEO_TILE_CORNER         0x30
+#define NEO_TILE_ROWS           0x00
+#define NEO_TILE_COLUMNS        0x40
+#define NEO_TILE_AXIS           0x40
+#define NEO_TILE_PROGRESSIVE    0x00
+#define NEO_TILE_ZIGZAG         0x80
+#define NEO_TILE_SEQUENCE       0x80
@@ -0,0 +1,39 @@
+// Host shim of the Arduino Print class
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+class String;
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t write(const char *s) { return s ? write((const uint8_t *) s, strlen(s)) : 0; }
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t) c); }
+    size_t print(const String& s);
+    size_t print(int v) { return printNumber(v); }
+    size_t print(unsigned int v) { return printNumber(v); }
+    size_t print(long v) { return printNumber(v); }
+    size_t print(unsigned long v) { return printNumber(v); }
+
+    size_t println() { return write('\n'); }
+    template <typename T> size_t println(const T& v) { return print(v) + println(); }
+
+private:
+    size_t printNumber(long long v);
+};
@@ -0,0 +1,50 @@
+// Host shim of the Arduino core
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include <Arduino.h>
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+
+static const std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+static bool millisSet = false;
+static unsigned long millisValue = 0;
+
+unsigned long micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+}
+
+unsigned long millis() {
+    return millisSet ? millisValue : micros() / 1000;
+}
+
+void setMillis(unsigned long ms) {
+    millisSet = true;
+    millisValue = ms;
+}
+
+void delay(unsigned long ms) {
+    if (millisSet) {
+        millisValue += ms;
+    } else {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+}
+
+String::String(float v, unsigned int decimals) {
+    char b[32];
+    snprintf(b, sizeof(b), "%.*f", (int) decimals, v);
+    s_ = b;
+}
+
+size_t Print::print(const String& s) {
+    return write(s.c_str());
+}
+
+size_t Print::printNumber(long long v) {
+    char b[24];
+    snprintf(b, sizeof(b), "%lld", v);
+    return write(b);
+}
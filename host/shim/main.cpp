@@ -0,0 +1,12 @@
+// Host shim of the Arduino entry point, for sketches run to completion: setup() only
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include <Arduino.h>
+
+void setup();
+
+int main() {
+    setup();
+    return 0;
+}
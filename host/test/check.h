@@ -0,0 +1,29 @@
+// Minimal checks for the host tests, failures reported and counted, main returns the count
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <stdio.h>
+
+static int checkFailures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            checkFailures++; \
+        } \
+    } while (0)
+
+#define CHECK_EQ(actual, expected) do { \
+        long long a_ = (long long) (actual), e_ = (long long) (expected); \
+        if (a_ != e_) { \
+            printf("%s:%d: check failed: %s == %s (%lld != %lld)\n", __FILE__, __LINE__, #actual, #expected, a_, e_); \
+            checkFailures++; \
+        } \
+    } while (0)
+
+static inline int checkResult() {
+    printf("%s, %d failed\n", checkFailures ? "FAILED" : "OK", checkFailures);
+    return checkFailures ? 1 : 0;
+}
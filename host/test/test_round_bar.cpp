@@ -0,0 +1,127 @@
+// Round bar beneath the countdown, laid out by CountdownLayout, against the code it replaced
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+//
+// The reference is displayRoundWithCountdown() as it was before the layout table, with its
+// hand-tuned switch of segment offsets, for the 32 pixels wide display. Every round count
+// from 1 to 60 with every current round, none to the last, must draw the same pixels.
+
+#include <emulator.h>
+#include "check.h"
+
+#define MAX_ROUNDS 60
+#define BAR_LINE ((Emulator_hw::height - 8) / 2 + 7)  // bottom row of the screens, centered vertically
+
+static_assert(Emulator_hw::width == 32, "the reference is the round bar of the 32 pixels wide display");
+
+enum BarPixel : uint8_t { BAR_OFF, BAR_INACTIVE, BAR_ACTIVE };
+
+struct Row {
+    BarPixel pixel[Emulator_hw::width];
+
+    void hline(int x, int w, BarPixel p) {
+        for (int i = x; i < x + w; i++) {
+            set(i, p);
+        }
+    }
+    void set(int x, BarPixel p) {
+        if (x >= 0 && x < Emulator_hw::width) {
+            pixel[x] = p;
+        }
+    }
+};
+
+static Row reference(int currentRound, int totalRounds) {
+    Row row = {};
+    int displayWidth = Emulator_hw::width;
+    if (totalRounds < displayWidth / 2) {
+        int lineWidth = displayWidth / totalRounds, offset;
+        switch (totalRounds) {
+            case 3:
+            case 5:
+            case 14:
+                offset = 2;
+                break;
+            case 7:
+            case 9:
+            case 13:
+                offset = 3;
+                break;
+            case 12:
+                offset = 4;
+                break;
+            case 11:
+                offset = 5;
+                break;
+            default:
+                offset = 1;
+        }
+        for (int i = 0; i < totalRounds; i++) {
+            row.hline(i * lineWidth + offset, lineWidth - 1, (i == currentRound - 1) ? BAR_ACTIVE : BAR_INACTIVE);
+        }
+    } else {
+        int t = totalRounds <= displayWidth ? totalRounds : displayWidth;
+        int start = (displayWidth - (t + (t <= displayWidth - 2 ? 2 : 0))) / 2;
+        for (int i = 0; i < t; i++) {
+            if (totalRounds <= displayWidth - 2 && (i == currentRound - 1 || i == currentRound)) {
+                start++;
+            }
+            row.set(start + i, (i == currentRound - 1) ? BAR_ACTIVE : BAR_INACTIVE);
+        }
+    }
+    return row;
+}
+
+// Bar row of the countdown screen, its colors told apart by the reference: off is black,
+// the inactive rounds share one color and the current round has another.
+static bool matches(int currentRound, int totalRounds, CRGB *inactive, CRGB *active) {
+    Emulator_hw e(nullptr, EMULATOR_ANSI);
+    e.frame(0);
+    e.displayCountdown(2000, 3600, false, currentRound, totalRounds, 0);
+    e.frame(0);
+    Row expected = reference(currentRound, totalRounds);
+    for (int16_t x = 0; x < Emulator_hw::width; x++) {
+        CRGB c = e.pixel(x, BAR_LINE);
+        switch (expected.pixel[x]) {
+            case BAR_OFF:
+                if (c) {
+                    return false;
+                }
+                break;
+            case BAR_INACTIVE:
+                if (!*inactive) {
+                    *inactive = c;
+                }
+                if (!c || c != *inactive) {
+                    return false;
+                }
+                break;
+            case BAR_ACTIVE:
+                if (!*active) {
+                    *active = c;
+                }
+                if (!c || c != *active) {
+                    return false;
+                }
+                break;
+        }
+    }
+    return true;
+}
+
+int main() {
+    CRGB inactive = CRGB::Black, active = CRGB::Black;
+    uint32_t cases = 0, mismatches = 0;
+    for (int rounds = 1; rounds <= MAX_ROUNDS; rounds++) {
+        for (int round = 0; round <= rounds; round++) {
+            cases++;
+            if (!matches(round, rounds, &inactive, &active) && mismatches++ < 10) {
+                printf("round %d of %d: bar differs\n", round, rounds);
+            }
+        }
+    }
+    printf("%u cases compared\n", (unsigned) cases);
+    CHECK_EQ(mismatches, 0);
+    CHECK(inactive != active);
+    return checkResult();
+}
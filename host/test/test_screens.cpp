@@ -0,0 +1,97 @@
+// Golden frames of the screens of each DisplayState, drawn by the emulator backend
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+//
+// Each case shows a screen on a fresh emulator at 0 ms, steps the render loop by 10 ms up
+// to the time given and compares the checksum of the framebuffer with the golden one.
+// After a deliberate change to what is shown, run with --update to print the table anew,
+// look at the frames with --show (ANSI truecolor) first.
+
+#include <emulator.h>
+#include "check.h"
+
+struct Golden {
+    DisplayState state;
+    const char *name;
+    void (*show)(Emulator_hw& e);
+    uint32_t ms;            // time of the frame compared
+    uint32_t checksum;
+};
+
+static void countdown(Emulator_hw& e, long remaining, uint32_t timerLength = 3600, bool paused = false, int round = 2, int rounds = 5, time_t now = 0) {
+    e.displayCountdown(remaining, timerLength, paused, round, rounds, now);
+}
+
+// DISPLAY_DONT_UPDATE and DISPLAY_ENFORCE_REFRESH only steer the data refresh in main.cpp,
+// the screen shown stays, they have no frames of their own.
+static const Golden golden[] = {
+    { DISPLAY_BOOT, "splash", [](Emulator_hw& e) { e.splashScreen(false); }, 0, 0xa7ed0fd3UL },
+    { DISPLAY_BOOT, "splash+progress", [](Emulator_hw& e) { e.splashScreen(true); }, 350, 0xdf1ed4b6UL },
+    { DISPLAY_BOOT, "connecting", [](Emulator_hw& e) { e.println("Connecting to WiFi"); }, 250, 0x91b3b174UL },
+    { DISPLAY_BOOT, "status line", [](Emulator_hw& e) { e.println("Event ID not set"); }, 1000, 0x01c3cc0cUL },
+    { DISPLAY_BOOT, "error", [](Emulator_hw& e) { e.println("Error: no WiFi"); }, 1000, 0xd6acce78UL },
+    { DISPLAY_BOOT, "config page", [](Emulator_hw& e) { e.configServerMsg("Config page http://192.168.4.1"); }, 1500, 0x10fd7e90UL },
+    { DISPLAY_EVENT_NAME, "event name", [](Emulator_hw& e) { e.displayEventName("Prague Open"); }, 800, 0x4ec3d03aUL },
+    { DISPLAY_EVENT_NAME, "event name scrolled", [](Emulator_hw& e) { e.displayEventName("Warhammer 40k Grand Tournament"); }, 2000, 0x8255907bUL },
+    { DISPLAY_EVENT_NAME, "event name emoji", [](Emulator_hw& e) { e.displayEventName("GT \xF0\x9F\x8F\x86 \xF0\x9F\x87\xA8\xF0\x9F\x87\xBF Praha"); }, 2500, 0x30f7553bUL },
+    { DISPLAY_EVENT_ROUND, "round", [](Emulator_hw& e) { e.displayEventRound(3); }, 0, 0xa83baf59UL },
+    { DISPLAY_EVENT_ROUND, "round 10", [](Emulator_hw& e) { e.displayEventRound(10); }, 0, 0xa5ceda9cUL },
+    { DISPLAY_EVENT_COUNTDOWN, "mm:ss", [](Emulator_hw& e) { countdown(e, 2000); }, 0, 0x527e103cUL },
+    { DISPLAY_EVENT_COUNTDOWN, "mm:ss rolling", [](Emulator_hw& e) { countdown(e, 2000); e.frame(1000); countdown(e, 1999, 3600, false, 2, 5, 1); }, 1100, 0xe75d4478UL },
+    { DISPLAY_EVENT_COUNTDOWN, "yellow", [](Emulator_hw& e) { countdown(e, 500); }, 0, 0x7121c869UL },
+    { DISPLAY_EVENT_COUNTDOWN, "red", [](Emulator_hw& e) { e.setThresholds(600, 60); countdown(e, 42); }, 0, 0x8da2220bUL },
+    { DISPLAY_EVENT_COUNTDOWN, "overtime", [](Emulator_hw& e) { countdown(e, -75); }, 0, 0x2c2be1d5UL },
+    { DISPLAY_EVENT_COUNTDOWN, "overtime pulse", [](Emulator_hw& e) { e.setOvertimeEffect(EFFECT_PULSE); countdown(e, -75); }, 500, 0x7d41ad57UL },
+    { DISPLAY_EVENT_COUNTDOWN, "overtime past hour", [](Emulator_hw& e) { countdown(e, -3700); }, 0, 0x9c8fb4a0UL },
+    { DISPLAY_EVENT_COUNTDOWN, "paused on", [](Emulator_hw& e) { countdown(e, 1500, 3600, true, 2, 5, 1); }, 0, 0x16e74e97UL },
+    { DISPLAY_EVENT_COUNTDOWN, "paused off", [](Emulator_hw& e) { countdown(e, 1500, 3600, true, 2, 5, 2); }, 0, 0xf59f4b57UL },
+    { DISPLAY_EVENT_COUNTDOWN, "not started", [](Emulator_hw& e) { countdown(e, 3600 + 300); }, 0, 0x0a3ef5d7UL },
+    { DISPLAY_EVENT_COUNTDOWN, "h:mm:ss", [](Emulator_hw& e) { countdown(e, 9000, 10800); }, 0, 0xe7fa66c8UL },
+    { DISPLAY_EVENT_COUNTDOWN, "hh:mm:ss", [](Emulator_hw& e) { countdown(e, 40000, 43200); }, 0, 0xa236713eUL },
+    { DISPLAY_EVENT_COUNTDOWN, "3 rounds", [](Emulator_hw& e) { countdown(e, 2000, 3600, false, 1, 3); }, 0, 0x79302d3cUL },
+    { DISPLAY_EVENT_COUNTDOWN, "24 rounds", [](Emulator_hw& e) { countdown(e, 2000, 3600, false, 12, 24); }, 0, 0xce3ab5b4UL },
+    { DISPLAY_EVENT_COUNTDOWN, "40 rounds", [](Emulator_hw& e) { countdown(e, 2000, 3600, false, 20, 40); }, 0, 0xfe763724UL },
+    { DISPLAY_EVENT_COUNTDOWN, "overlay", [](Emulator_hw& e) { countdown(e, 2000); e.showOverlay("Config page http://192.168.4.1"); }, 500, 0x0586bbc7UL },
+    { DISPLAY_EVENT_COUNTDOWN, "rainbow", [](Emulator_hw& e) { countdown(e, 2000); e.setEffect(EFFECT_RAINBOW); }, 500, 0x200a32cfUL },
+};
+
+static uint32_t render(const Golden& g, Print *show) {
+    Emulator_hw e(show, EMULATOR_ANSI);
+    e.frame(0);
+    g.show(e);
+    for (uint32_t t = 0; t <= g.ms; t += 10) {
+        e.frame(t);
+    }
+    e.frame(g.ms);
+    return e.checksum();
+}
+
+int main(int argc, char **argv) {
+    bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+    bool show = argc > 1 && strcmp(argv[1], "--show") == 0;
+    for (const Golden& g : golden) {
+        if (show) {
+            printf("%s\n", g.name);
+        }
+        uint32_t checksum = render(g, show ? &Serial : nullptr);
+        if (update) {
+            printf("0x%08xUL  %s\n", (unsigned) checksum, g.name);
+        } else if (!show && checksum != g.checksum) {
+            printf("%s: checksum 0x%08x, golden 0x%08x\n", g.name, (unsigned) checksum, (unsigned) g.checksum);
+            checkFailures++;
+        }
+    }
+    if (update || show) {
+        return 0;
+    }
+    // the frames compared differ from each other, none is left blank by a broken screen
+    for (size_t i = 0; i < sizeof(golden) / sizeof(golden[0]); i++) {
+        for (size_t j = i + 1; j < sizeof(golden) / sizeof(golden[0]); j++) {
+            if (golden[i].checksum == golden[j].checksum) {
+                printf("%s and %s: same golden frame\n", golden[i].name, golden[j].name);
+                checkFailures++;
+            }
+        }
+    }
+    return checkResult();
+}
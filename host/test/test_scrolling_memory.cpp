@@ -0,0 +1,103 @@
+// Memory of a long announcement scrolled through: pixels kept for the window only
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+//
+// Heap in use is tracked by the allocator wrappers below, linked in by -Wl,--wrap=malloc
+// (and free, calloc, realloc, see CMakeLists.txt). Besides its glyph list, which the text
+// needs whatever is drawn, the peak must stay within a window of display width, while a
+// canvas as wide as the text would take over a hundred kilobytes.
+
+#include <malloc.h>
+#include <layer.h>
+#include <scrolling_text.h>
+#include <f3x5.h>
+#include "check.h"
+
+#define DISPLAY_WIDTH 32
+#define ANNOUNCEMENT_LENGTH 2000
+
+// ---- Heap tracking ----
+
+static size_t heapInUse = 0, heapPeak = 0;
+
+static void *counted(void *p) {
+    if (p != nullptr) {
+        heapInUse += malloc_usable_size(p);
+        heapPeak = _max(heapPeak, heapInUse);
+    }
+    return p;
+}
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t size);
+void __real_free(void *p);
+
+void *__wrap_malloc(size_t size) { return counted(__real_malloc(size)); }
+void *__wrap_calloc(size_t n, size_t size) { return counted(__real_calloc(n, size)); }
+
+void *__wrap_realloc(void *p, size_t size) {
+    size_t old = (p != nullptr) ? malloc_usable_size(p) : 0;
+    void *q = __real_realloc(p, size);
+    if (q != nullptr || size == 0) {
+        heapInUse -= old;
+    }
+    return counted(q);
+}
+
+void __wrap_free(void *p) {
+    if (p != nullptr) {
+        heapInUse -= malloc_usable_size(p);
+    }
+    __real_free(p);
+}
+}
+
+static void checkPool(const MemoryPool &pool) {
+    CHECK_EQ(pool.highWater(), 1);
+    CHECK_EQ(pool.exhausted(), 0);
+}
+
+int main() {
+    static const UTF8_32BitFont *font = &F3x5[0];
+    Layer layer(DISPLAY_WIDTH, 8);
+
+    char announcement[ANNOUNCEMENT_LENGTH + 1];
+    static const char sentence[] = "Round 3 pairings are up, Warhammer 40k Grand Tournament Prague, lunch at 12:30. ";
+    for (size_t i = 0; i < ANNOUNCEMENT_LENGTH; i++) {
+        announcement[i] = sentence[i % (sizeof(sentence) - 1)];
+    }
+    announcement[ANNOUNCEMENT_LENGTH] = '\0';
+
+    // font index and pools set up by a short text first, they do not depend on the text length
+    delete new ScrollingText(&layer, "Prague Open", 0, 7, font, true, 1, DISPLAY_WIDTH);
+
+    size_t baseline = heapInUse;
+    heapPeak = heapInUse;
+    ScrollingText *text = new ScrollingText(&layer, announcement, 0, 7, font, true, 1, DISPLAY_WIDTH);
+    size_t created = heapInUse, createdPeak = heapPeak;
+
+    // every column of the strip (no glyph is wider than 8 pixels) scrolled through the window
+    for (uint32_t i = 0; i < ANNOUNCEMENT_LENGTH * 8; i++) {
+        text->step();
+    }
+    CHECK_EQ(heapInUse, created);
+    CHECK_EQ(heapPeak, createdPeak);
+
+    // layout of the announcement, its glyphs and the copy of the text in one block off the heap
+    size_t layout = ANNOUNCEMENT_LENGTH * sizeof(PlacedGlyph) + sizeof(TextLayout) + sizeof(announcement) + 64;
+    size_t window = DISPLAY_WIDTH * SCROLLING_TEXT_BAND_HEIGHT * sizeof(uint16_t);
+    printf("heap peak %u bytes over the baseline, layout bound %u, window %u\n", (unsigned) (heapPeak - baseline), (unsigned) layout, (unsigned) window);
+    CHECK(heapPeak - baseline <= layout + window);
+
+    checkPool(ScrollingText::pool());
+    checkPool(ScrollingText::segmentPool());
+    checkPool(ScrollingText::windowPool());
+    // the short text laid out in a pool block, the announcement too long for one
+    CHECK_EQ(LayoutCache::pool().highWater(), 2);
+    CHECK_EQ(LayoutCache::pool().exhausted(), 1);
+
+    delete text;
+    return checkResult();
+}
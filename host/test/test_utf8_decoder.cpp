@@ -0,0 +1,255 @@
+// UTF8Decoder against a reference decoder, on known sequences, on all sequences of up
+// to three bytes and on random streams
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+//
+// The reference is the straightforward decoder of the WHATWG Encoding Standard, which
+// replaces each maximal subpart of an invalid sequence by U+FFFD, as Unicode recommends.
+
+#include <vector>
+#include <utf8_decoder.h>
+#include "check.h"
+
+typedef std::vector<uint32_t> Codepoints;
+
+static Codepoints reference(const uint8_t *s, size_t len) {
+    Codepoints out;
+    uint32_t cp = 0;
+    uint8_t needed = 0, seen = 0, lower = 0x80, upper = 0xBF;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = s[i];
+        if (needed == 0) {
+            if (c <= 0x7F) {
+                out.push_back(c);
+            } else if (c >= 0xC2 && c <= 0xDF) {
+                needed = 1;
+                cp = c & 0x1F;
+            } else if (c >= 0xE0 && c <= 0xEF) {
+                lower = (c == 0xE0) ? 0xA0 : 0x80;
+                upper = (c == 0xED) ? 0x9F : 0xBF;
+                needed = 2;
+                cp = c & 0x0F;
+            } else if (c >= 0xF0 && c <= 0xF4) {
+                lower = (c == 0xF0) ? 0x90 : 0x80;
+                upper = (c == 0xF4) ? 0x8F : 0xBF;
+                needed = 3;
+                cp = c & 0x07;
+            } else {
+                out.push_back(0xFFFD);
+            }
+            continue;
+        }
+        if (c < lower || c > upper) {
+            // the sequence so far is replaced, the byte is read again
+            needed = seen = 0;
+            lower = 0x80;
+            upper = 0xBF;
+            out.push_back(0xFFFD);
+            i--;
+            continue;
+        }
+        lower = 0x80;
+        upper = 0xBF;
+        cp = (cp << 6) | (c & 0x3F);
+        if (++seen == needed) {
+            out.push_back(cp);
+            needed = seen = 0;
+        }
+    }
+    if (needed != 0) {
+        out.push_back(0xFFFD);
+    }
+    return out;
+}
+
+static Codepoints decode(UTF8Decoder& decoder, const uint8_t *s, size_t len, bool finish = true) {
+    Codepoints out;
+    uint32_t cp[2];
+    for (size_t i = 0; i < len; i++) {
+        for (uint8_t j = 0, n = decoder.feed(s[i], cp); j < n; j++) {
+            out.push_back(cp[j]);
+        }
+    }
+    if (finish && decoder.finish(cp)) {
+        out.push_back(cp[0]);
+    }
+    return out;
+}
+
+static Codepoints decode(const uint8_t *s, size_t len) {
+    UTF8Decoder decoder;
+    return decode(decoder, s, len);
+}
+
+static void print(const char *label, const Codepoints& cps) {
+    printf("  %s:", label);
+    for (uint32_t cp : cps) {
+        printf(" %04X", (unsigned) cp);
+    }
+    printf("\n");
+}
+
+static void printBytes(const uint8_t *s, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        printf(" %02X", s[i]);
+    }
+    printf("\n");
+}
+
+// Both decoders give the codepoints expected
+struct Case {
+    const char *name;
+    const char *bytes;
+    Codepoints expected;
+};
+
+static const Case cases[] = {
+    { "ascii", "Round 3", { 'R', 'o', 'u', 'n', 'd', ' ', '3' } },
+    { "two bytes", "\xC5\x99", { 0x0159 } },
+    { "three bytes", "\xE2\x82\xAC", { 0x20AC } },
+    { "four bytes", "\xF0\x9F\x8F\x86", { 0x1F3C6 } },
+    { "range ends", "\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF", { 0x80, 0x7FF, 0x800, 0xFFFF, 0x10000, 0x10FFFF } },
+    // Unicode 15, table 3-8: maximal subparts replaced one by one
+    { "maximal subparts", "\x61\xF1\x80\x80\xE1\x80\xC2\x62\x80\x63\x80\xBF\x64", { 0x61, 0xFFFD, 0xFFFD, 0xFFFD, 0x62, 0xFFFD, 0x63, 0xFFFD, 0xFFFD, 0x64 } },
+    { "stray continuation", "\x80", { 0xFFFD } },
+    { "invalid bytes", "\xC0\xC1\xF5\xFF", { 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD } },
+    { "overlong 2", "\xC0\xAF", { 0xFFFD, 0xFFFD } },
+    { "overlong 3", "\xE0\x80\xAF", { 0xFFFD, 0xFFFD, 0xFFFD } },
+    { "overlong 4", "\xF0\x80\x80\xAF", { 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD } },
+    { "overlong nul", "\xC0\x80", { 0xFFFD, 0xFFFD } },
+    { "surrogate high", "\xED\xA0\x80", { 0xFFFD, 0xFFFD, 0xFFFD } },
+    { "surrogate low", "\xED\xBF\xBF", { 0xFFFD, 0xFFFD, 0xFFFD } },
+    { "before surrogates", "\xED\x9F\xBF", { 0xD7FF } },
+    { "beyond U+10FFFF", "\xF4\x90\x80\x80", { 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD } },
+    { "interrupted by ascii", "\xE2\x82" "A", { 0xFFFD, 'A' } },
+    { "interrupted by lead", "\xF0\x9F\xC5\x99", { 0xFFFD, 0x0159 } },
+    { "truncated 2", "\xC5", { 0xFFFD } },
+    { "truncated 3", "\xE2\x82", { 0xFFFD } },
+    { "truncated 4", "\xF0\x9F\x8F", { 0xFFFD } },
+};
+
+static void checkCases() {
+    for (const Case& c : cases) {
+        const uint8_t *s = (const uint8_t *) c.bytes;
+        size_t len = strlen(c.bytes);
+        Codepoints got = decode(s, len), ref = reference(s, len);
+        if (got != c.expected || ref != c.expected) {
+            printf("%s:\n", c.name);
+            print("decoder", got);
+            print("reference", ref);
+            print("expected", c.expected);
+            checkFailures++;
+        }
+    }
+}
+
+// Truncated input gives nothing until finish(), which replaces the incomplete sequence once
+static void checkFinish() {
+    UTF8Decoder decoder;
+    uint32_t cp[2];
+    CHECK(decode(decoder, (const uint8_t *) "\xF0\x9F\x8F", 3, false).empty());
+    CHECK(!decoder.idle());
+    CHECK_EQ(decoder.finish(cp), 1);
+    CHECK_EQ(cp[0], 0xFFFD);
+    CHECK(decoder.idle());
+    CHECK_EQ(decoder.finish(cp), 0);
+    // a complete text leaves nothing to finish
+    CHECK_EQ(decode(decoder, (const uint8_t *) "\xC5\x99", 2, false).size(), 1);
+    CHECK_EQ(decoder.finish(cp), 0);
+}
+
+// A text split anywhere, ASCII runs and multibyte sequences alike, decodes the same in
+// chunks; two streams fed in turns keep their state apart
+static void checkSplit() {
+    static const char text[] = "GT \xF0\x9F\x8F\x86 P\xC5\x99\xC3\xADli\xC5\xA1 \xE2\x82\xAC" "5";
+    const uint8_t *s = (const uint8_t *) text;
+    size_t len = sizeof(text) - 1;
+    Codepoints whole = reference(s, len);
+    for (size_t split = 0; split <= len; split++) {
+        UTF8Decoder decoder;
+        Codepoints got = decode(decoder, s, split, false);
+        Codepoints rest = decode(decoder, s + split, len - split);
+        got.insert(got.end(), rest.begin(), rest.end());
+        if (got != whole) {
+            printf("split at %u:\n", (unsigned) split);
+            print("decoder", got);
+            print("reference", whole);
+            checkFailures++;
+        }
+    }
+
+    static const char other[] = "\xC4\x8D\xC4\x8D" "ab\xF0\x9F\x87\xA8\xF0\x9F\x87\xBF" "cd\xE2\x82\xAC";
+    const uint8_t *o = (const uint8_t *) other;
+    size_t otherLen = sizeof(other) - 1;
+    UTF8Decoder a, b;
+    Codepoints gotA, gotB;
+    uint32_t cp[2];
+    for (size_t i = 0; i < _max(len, otherLen); i++) {
+        if (i < len) {
+            for (uint8_t j = 0, n = a.feed(s[i], cp); j < n; j++) {
+                gotA.push_back(cp[j]);
+            }
+        }
+        if (i < otherLen) {
+            for (uint8_t j = 0, n = b.feed(o[i], cp); j < n; j++) {
+                gotB.push_back(cp[j]);
+            }
+        }
+    }
+    CHECK(gotA == whole);
+    CHECK(gotB == reference(o, otherLen));
+    CHECK(a.idle() && b.idle());
+}
+
+// All sequences of one to three bytes
+static void checkExhaustive() {
+    uint8_t s[3];
+    uint32_t mismatches = 0;
+    for (uint32_t v = 0; v < (1UL << 24); v++) {
+        s[0] = v >> 16;
+        s[1] = v >> 8;
+        s[2] = v;
+        for (size_t len = 1; len <= 3; len++) {
+            // shorter sequences are covered once, by their first appearance
+            if ((len == 1 && (v & 0xFFFF) != 0) || (len == 2 && (v & 0xFF) != 0)) {
+                continue;
+            }
+            if (decode(s, len) != reference(s, len) && mismatches++ < 10) {
+                printf("mismatch:");
+                printBytes(s, len);
+            }
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+// Random streams, bytes drawn mostly from the leads and continuations, so that valid,
+// truncated and invalid sequences all come up
+static void checkRandom() {
+    static const uint8_t interesting[] = { 0x00, 0x41, 0x7F, 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC0, 0xC1, 0xC2, 0xDF, 0xE0, 0xE1, 0xED, 0xEF, 0xF0, 0xF1, 0xF4, 0xF5, 0xFF };
+    uint32_t seed = 2025;
+    uint8_t s[64];
+    uint32_t mismatches = 0;
+    for (uint32_t round = 0; round < 200000; round++) {
+        seed = seed * 1664525u + 1013904223u;
+        size_t len = 1 + (seed >> 24) % sizeof(s);
+        for (size_t i = 0; i < len; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            s[i] = ((seed >> 16) & 3) ? interesting[(seed >> 8) % sizeof(interesting)] : (uint8_t) (seed >> 24);
+        }
+        if (decode(s, len) != reference(s, len) && mismatches++ < 10) {
+            printf("mismatch:");
+            printBytes(s, len);
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+int main() {
+    checkCases();
+    checkFinish();
+    checkSplit();
+    checkExhaustive();
+    checkRandom();
+    return checkResult();
+}
@@ -0,0 +1,31 @@
+// Abstract class for animations on Adafruit_GFX displays
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "animation.h"
+
+bool GFXanimation::update(uint32_t now) {
+    if (!isActive) {
+        return false;
+    }
+    if (!started_) {
+        started_ = true;
+        lastMs_ = now;
+        return false;
+    }
+    uint32_t due = (now - lastMs_) / intervalMs_;
+    if (due == 0) {
+        return false;
+    }
+    // advancing by whole frames keeps the frame grid, and the difference small
+    lastMs_ += due * intervalMs_;
+    frames_ += due;
+    droppedFrames_ += due - 1;
+    for (uint32_t i = 1; i < due && isActive; i++) {
+        step(false);
+    }
+    if (isActive) {
+        step(true);
+    }
+    return true;
+}
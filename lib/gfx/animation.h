@@ -6,13 +6,42 @@
 
 #include <Adafruit_GFX.h>
 
+#define DEFAULT_ANIMATION_INTERVAL 100  // milliseconds per frame
+
+// Animations move by frames, frame n being due n intervals after the start. update()
+// runs the frames due by the given time: when late, the missed frames are stepped
+// through without drawing and counted as dropped, and only the current one is drawn,
+// so the motion keeps its pace regardless of how often update() gets called.
 class GFXanimation {
 public:
     GFXanimation(Adafruit_GFX *gfx) : gfx_(gfx) {};
-    virtual void step(bool draw = true);
-    virtual void draw();
+    virtual ~GFXanimation() {};
+
+    // Moves the animation by one frame
+    virtual void step(bool draw = true) = 0;
+    virtual void draw() = 0;
+
+    // Returns true if any frame was due (and the animation has moved). The first
+    // call after construction or restart() starts the timing.
+    bool update(uint32_t now);
+    void restart() { started_ = false; }
+    // Time the next frame is due at, valid once started
+    inline uint32_t nextFrameAt() const { return lastMs_ + intervalMs_; }
+
+    void setInterval(uint16_t intervalMs) { intervalMs_ = (intervalMs > 0) ? intervalMs : 1; }
+    inline uint16_t interval() const { return intervalMs_; }
+
+    inline uint32_t frames() const { return frames_; }
+    inline uint32_t droppedFrames() const { return droppedFrames_; }
+
     bool isActive;
 
 protected:
     Adafruit_GFX *gfx_;
-};
\ No newline at end of file
+
+private:
+    uint16_t intervalMs_ = DEFAULT_ANIMATION_INTERVAL;
+    uint32_t lastMs_ = 0;   // time of the last frame, kept on the frame grid
+    bool started_ = false;
+    uint32_t frames_ = 0, droppedFrames_ = 0;
+};
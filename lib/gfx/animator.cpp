@@ -0,0 +1,147 @@
+// Class Animator - drives any number of GFXanimations, each at its own interval
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "animator.h"
+
+bool Animator::add(GFXanimation *animation, uint32_t now, bool deleteWhenDone) {
+    if (animation == nullptr || count_ >= ANIMATOR_MAX_ANIMATIONS || find(animation) >= 0) {
+        return false;
+    }
+    entries_[count_++] = { animation, now, deleteWhenDone }; // parked, until restarted
+    restart(animation, now);
+    return true;
+}
+
+void Animator::remove(GFXanimation *animation) {
+    int16_t i = find(animation);
+    if (i >= 0) {
+        erase(i);
+    }
+}
+
+void Animator::release(GFXanimation *animation) {
+    int16_t i = find(animation);
+    if (i >= 0) {
+        erase(i, false);
+    }
+}
+
+void Animator::clear() {
+    for (uint8_t i = 0; i < count_; i++) {
+        delete entries_[i].animation;
+    }
+    heapSize_ = count_ = 0;
+}
+
+void Animator::restart(GFXanimation *animation, uint32_t now) {
+    int16_t i = find(animation);
+    if (i < 0) {
+        return;
+    }
+    animation->restart();
+    animation->update(now); // starts the timing, if active
+    if (!animation->isActive) {
+        if (i < heapSize_) {
+            park(i);
+        }
+        return;
+    }
+    entries_[i].due = animation->nextFrameAt();
+    if (i >= heapSize_) {
+        unpark(i);
+    } else {
+        siftDown(i);
+        siftUp(i);
+    }
+}
+
+bool Animator::update(uint32_t now) {
+    bool moved = false;
+    while (heapSize_ > 0 && (int32_t) (entries_[0].due - now) <= 0) {
+        GFXanimation *animation = entries_[0].animation;
+        moved |= animation->update(now);
+        if (animation->isActive) {
+            entries_[0].due = animation->nextFrameAt();
+            siftDown(0);
+        } else {
+            park(0);
+            if (entries_[heapSize_].deleteWhenDone) {
+                erase(heapSize_);
+            }
+        }
+    }
+    return moved;
+}
+
+int16_t Animator::find(GFXanimation *animation) const {
+    for (uint8_t i = 0; i < count_; i++) {
+        if (entries_[i].animation == animation) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Moves heap entry i to the start of the parked entries.
+void Animator::park(uint8_t i) {
+    Entry e = entries_[i];
+    heapSize_--;
+    if (i != heapSize_) {
+        entries_[i] = entries_[heapSize_];
+        siftDown(i);
+        siftUp(i);
+    }
+    entries_[heapSize_] = e;
+}
+
+// Moves parked entry i into the heap.
+void Animator::unpark(uint8_t i) {
+    Entry e = entries_[i];
+    entries_[i] = entries_[heapSize_];
+    entries_[heapSize_] = e;
+    siftUp(heapSize_++);
+}
+
+void Animator::erase(uint8_t i, bool destroy) {
+    if (i < heapSize_) {
+        park(i);
+        i = heapSize_;
+    }
+    if (destroy) {
+        delete entries_[i].animation;
+    }
+    entries_[i] = entries_[--count_];
+}
+
+void Animator::siftUp(uint8_t i) {
+    while (i > 0) {
+        uint8_t parent = (i - 1) / 2;
+        if (!before(entries_[i], entries_[parent])) {
+            break;
+        }
+        Entry e = entries_[i];
+        entries_[i] = entries_[parent];
+        entries_[parent] = e;
+        i = parent;
+    }
+}
+
+void Animator::siftDown(uint8_t i) {
+    while (true) {
+        uint8_t least = i, l = 2 * i + 1, r = l + 1;
+        if (l < heapSize_ && before(entries_[l], entries_[least])) {
+            least = l;
+        }
+        if (r < heapSize_ && before(entries_[r], entries_[least])) {
+            least = r;
+        }
+        if (least == i) {
+            break;
+        }
+        Entry e = entries_[i];
+        entries_[i] = entries_[least];
+        entries_[least] = e;
+        i = least;
+    }
+}
@@ -0,0 +1,58 @@
+// Class Animator - drives any number of GFXanimations, each at its own interval
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <animation.h>
+
+#define ANIMATOR_MAX_ANIMATIONS 16
+
+// Animations waiting for their next frame are kept in a binary min-heap by due time,
+// so update() costs O(log n) per animation due and nothing for the others.
+// Animations added are owned by the Animator and deleted by remove() (or by update()
+// once finished, if added so), unless taken back by release(); finished animations
+// are parked until then, so their owner may still check isActive. Use from the
+// display task only.
+class Animator {
+public:
+    ~Animator() { clear(); }
+
+    // Takes ownership and starts the timing, false if full (ownership not taken).
+    bool add(GFXanimation *animation, uint32_t now, bool deleteWhenDone = false);
+    // Deletes the animation, nullptr is ignored.
+    void remove(GFXanimation *animation);
+    // Stops driving the animation and gives it back to the caller, nullptr is ignored.
+    void release(GFXanimation *animation);
+    void clear();
+
+    // Reactivates a parked (or running) animation with the timing started anew.
+    void restart(GFXanimation *animation, uint32_t now);
+
+    // Runs the frames due, returns true if any animation has moved.
+    bool update(uint32_t now);
+
+    inline uint8_t count() const { return count_; }
+    inline uint8_t running() const { return heapSize_; }
+
+private:
+    struct Entry {
+        GFXanimation *animation;
+        uint32_t due;
+        bool deleteWhenDone;
+    };
+    // [0, heapSize_) heap of running animations, [heapSize_, count_) parked ones
+    Entry entries_[ANIMATOR_MAX_ANIMATIONS];
+    uint8_t heapSize_ = 0, count_ = 0;
+
+    static inline bool before(const Entry &a, const Entry &b) {
+        return (int32_t) (a.due - b.due) < 0; // millis() wrap safe
+    }
+    int16_t find(GFXanimation *animation) const;
+    void park(uint8_t i);
+    void unpark(uint8_t i);
+    void erase(uint8_t i, bool destroy = true);
+    void siftUp(uint8_t i);
+    void siftDown(uint8_t i);
+};
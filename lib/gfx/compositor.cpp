@@ -0,0 +1,118 @@
+// Class Compositor - merges stacked Layers into CRGB LED buffer, redrawing dirty regions only
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "compositor.h"
+
+bool Compositor::addLayer(Layer *layer) {
+    if (layerCount_ >= COMPOSITOR_MAX_LAYERS) {
+        return false;
+    }
+    layers_[layerCount_++] = layer;
+    layer->markDirty(0, 0, layer->width(), layer->height());
+    return true;
+}
+
+bool Compositor::addEffect(Effect *effect) {
+    if (effectCount_ >= COMPOSITOR_MAX_EFFECTS) {
+        return false;
+    }
+    effects_[effectCount_++] = effect;
+    return true;
+}
+
+bool Compositor::compose(uint32_t now) {
+    bool composed = false;
+    for (uint8_t i = 0; i < effectCount_; i++) {
+        if (effects_[i]->advance(now)) {
+            int16_t x0, y0, x1, y1;
+            effects_[i]->getClip(&x0, &y0, &x1, &y1);
+            x0 = _max(x0, 0);
+            y0 = _max(y0, 0);
+            x1 = _min(x1, width_ - 1);
+            y1 = _min(y1, height_ - 1);
+            if (x0 <= x1 && y0 <= y1) {
+                composeRegion(x0, y0, x1, y1);
+                composed = true;
+            }
+        }
+    }
+    for (uint8_t i = 0; i < layerCount_; i++) {
+        int16_t x0, y0, x1, y1;
+        if (layers_[i]->getDirtyRegion(&x0, &y0, &x1, &y1)) {
+            composeRegion(x0, y0, _min(x1, width_ - 1), _min(y1, height_ - 1));
+            layers_[i]->clearDirty();
+            composed = true;
+        }
+    }
+    return composed;
+}
+
+void Compositor::setPalette(const CRGB *palette, uint16_t size) {
+    palette_ = palette;
+    paletteSize_ = size;
+    invalidate();
+}
+
+void Compositor::invalidate() {
+    for (uint8_t i = 0; i < layerCount_; i++) {
+        layers_[i]->markDirty(0, 0, layers_[i]->width(), layers_[i]->height());
+    }
+}
+
+// Row by row straight into the LED buffer, no per pixel virtual calls nor clipping
+void Compositor::composeRegion(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    for (uint8_t i = 0; i < effectCount_; i++) {
+        if (effects_[i]->type() != EFFECT_NONE) {
+            composeEffectsRegion(x0, y0, x1, y1);
+            return;
+        }
+    }
+    for (int16_t y = y0; y <= y1; y++) {
+        const uint16_t *xy = &xyMap_[y * width_ + x0];
+        for (int16_t x = x0; x <= x1; x++) {
+            leds_[*xy++] = resolveColor(pixelAt(x, y));
+        }
+    }
+}
+
+// As composeRegion(), with the effects covering each pixel applied on top
+void Compositor::composeEffectsRegion(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    for (int16_t y = y0; y <= y1; y++) {
+        const uint16_t *xy = &xyMap_[y * width_ + x0];
+        for (int16_t x = x0; x <= x1; x++) {
+            int8_t layer;
+            uint16_t color = pixelAt(x, y, &layer);
+            CRGB rgb = resolveColor(color);
+            for (uint8_t i = 0; i < effectCount_; i++) {
+                const Effect *effect = effects_[i];
+                if (effect->covers(x, y) && (effect->target() == nullptr || (color != 0x0000 && layer >= 0 && layers_[layer] == effect->target()))) {
+                    rgb = effect->apply(rgb, x);
+                }
+            }
+            leds_[*xy++] = rgb;
+        }
+    }
+}
+
+// Topmost visible layer having either non-transparent color or opaque area at the position wins,
+// its index is returned in layer (-1 if none)
+inline uint16_t Compositor::pixelAt(int16_t x, int16_t y, int8_t *layer) const {
+    for (int8_t i = layerCount_ - 1; i >= 0; i--) {
+        const Layer *l = layers_[i];
+        if (!l->isVisible()) {
+            continue;
+        }
+        uint16_t color = l->getBuffer()[y * l->width() + x];
+        if (color != 0x0000 || l->isOpaqueAt(x, y)) {
+            if (layer != nullptr) {
+                *layer = i;
+            }
+            return color;
+        }
+    }
+    if (layer != nullptr) {
+        *layer = -1;
+    }
+    return 0x0000;
+}
@@ -0,0 +1,66 @@
+// Class Compositor - merges stacked Layers into CRGB LED buffer, redrawing dirty regions only
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <layer.h>
+#include <effect.h>
+
+#define COMPOSITOR_MAX_LAYERS 8
+#define COMPOSITOR_MAX_EFFECTS 4
+
+class Compositor {
+public:
+    // xyMap translates display position (y * width + x) into LED index, see XYMap
+    Compositor(CRGB *leds, const uint16_t *xyMap, int16_t width, int16_t height) : leds_(leds), xyMap_(xyMap), width_(width), height_(height) {};
+
+    // Layers are stacked in the order added, the first one at the bottom.
+    // All layers must have the size of the display.
+    bool addLayer(Layer *layer);
+
+    // Effects recolor the composed pixels, in the order added, above all layers.
+    bool addEffect(Effect *effect);
+
+    // Recomposite dirty regions of all layers, and clip areas of effects moved by the
+    // time given, into the LED buffer. Returns true if anything has been redrawn (LEDs
+    // need to be shown).
+    bool compose(uint32_t now = millis());
+
+    // Mark whole display to be redrawn on the next compose()
+    void invalidate();
+
+    // With palette set, layer colors are palette indices resolved to CRGB here, with no
+    // precision lost to RGB565 (indices out of the palette are black). Without palette,
+    // layer colors are taken as RGB565.
+    void setPalette(const CRGB *palette, uint16_t size);
+
+private:
+    CRGB *leds_;
+    const uint16_t *xyMap_;
+    int16_t width_, height_;
+    const CRGB *palette_ = nullptr;
+    uint16_t paletteSize_ = 0;
+    Layer *layers_[COMPOSITOR_MAX_LAYERS];
+    uint8_t layerCount_ = 0;
+    Effect *effects_[COMPOSITOR_MAX_EFFECTS];
+    uint8_t effectCount_ = 0;
+
+    void composeRegion(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    void composeEffectsRegion(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    inline uint16_t pixelAt(int16_t x, int16_t y, int8_t *layer = nullptr) const;
+
+    inline CRGB resolveColor(uint16_t color) const {
+        if (palette_ != nullptr) {
+            return color < paletteSize_ ? palette_[color] : CRGB(CRGB::Black);
+        }
+        return expandColor(color);
+    }
+
+    static inline CRGB expandColor(uint16_t color) {
+        uint8_t r = (color >> 11) & 0x1F, g = (color >> 5) & 0x3F, b = color & 0x1F;
+        return CRGB((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+    }
+};
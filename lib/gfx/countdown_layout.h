@@ -0,0 +1,136 @@
+// Compile-time layouts of the countdown and of the round bar beneath it
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <f3x5.h>
+#include <f4x6.h>
+
+#define COUNTDOWN_MAX_HOUR_DIGITS 2
+
+// Both tables are solved by the compiler from the font metrics for a display W pixels
+// wide, at runtime the layout is a plain table lookup.
+//
+// Countdown, for each sign and count of hour digits (0 for mm:ss): the digits are
+// centered, in the larger font if it leaves a margin, the odd pixel left over goes
+// to the left; a minus sign goes in front of them and must stay on the display.
+// Where nothing fits, fits is false.
+//
+// Round bar, for each round count: up to W / 2 rounds as segments with 1 pixel gaps,
+// above that as dots, the current one set apart with gaps if there is room for them.
+template <int16_t W>
+struct CountdownLayout {
+    struct Text {
+        const GFXfont *font;
+        int16_t x;      // cursor of the first character, the sign if any
+        bool fits;
+    };
+    struct Bar {
+        int16_t offset; // x of the first segment or dot
+        uint8_t pitch;  // 1 for dots
+        uint8_t width;  // segment width
+        bool gaps;      // dots only, gap around the current round
+    };
+    struct Texts {
+        Text text[2][COUNTDOWN_MAX_HOUR_DIGITS + 1];
+    };
+    struct Bars {
+        Bar bar[W + 1];
+    };
+
+    static constexpr const Text &text(bool negative, uint8_t hourDigits) {
+        return texts.text[negative][_min(hourDigits, (uint8_t) COUNTDOWN_MAX_HOUR_DIGITS)];
+    }
+    // Round counts above W share the layout of W, dots cut at the display width
+    static constexpr const Bar &bar(int rounds) {
+        return bars.bar[(rounds < 0) ? 0 : (rounds > W) ? W : rounds];
+    }
+
+    // ---- Solver ----
+    struct Font {
+        const GFXfont *font;
+        const GFXglyph *glyphs;
+    };
+    // larger first, both start at '-'
+    static constexpr Font fonts[] = { { &F4x6, F4x6Glyphs }, { &F3x5_Fixed, F3x5Glyphs_Fixed } };
+
+    // Ink extent of the text, relative to the cursor: [*left, *right)
+    static constexpr void inkOf(const Font &f, const char *s, int16_t *left, int16_t *right) {
+        int16_t pen = 0;
+        *left = INT16_MAX;
+        *right = INT16_MIN;
+        for (; *s != '\0'; s++) {
+            const GFXglyph &g = f.glyphs[*s - '-'];
+            if (g.width > 0) {
+                *left = _min(*left, (int16_t) (pen + g.xOffset));
+                *right = _max(*right, (int16_t) (pen + g.xOffset + g.width));
+            }
+            pen += g.xAdvance;
+        }
+    }
+
+    static constexpr Text solveText(bool negative, uint8_t hourDigits) {
+        const char *digits = (hourDigits == 0) ? "00:00" : (hourDigits == 1) ? "0:00:00" : "00:00:00";
+        for (int16_t margin = 1; margin >= 0; margin--) {
+            for (const Font &f : fonts) {
+                int16_t left = 0, right = 0;
+                inkOf(f, digits, &left, &right);
+                int16_t x = (W - (right - left) + 1) / 2 - left;
+                if (x + left < margin || x + right > W - margin) {
+                    continue;
+                }
+                if (negative) {
+                    int16_t signLeft = 0, signRight = 0;
+                    inkOf(f, "-", &signLeft, &signRight);
+                    x -= f.glyphs[0].xAdvance;
+                    if (x + signLeft < 0) {
+                        continue;
+                    }
+                }
+                return { f.font, x, true };
+            }
+        }
+        return { fonts[0].font, 0, false };
+    }
+
+    static constexpr Texts solveTexts() {
+        Texts t = {};
+        for (uint8_t negative = 0; negative < 2; negative++) {
+            for (uint8_t digits = 0; digits <= COUNTDOWN_MAX_HOUR_DIGITS; digits++) {
+                t.text[negative][digits] = solveText(negative, digits);
+            }
+        }
+        return t;
+    }
+
+    // Segment offsets on the 32 pixels wide display were tuned by eye, kept as they are
+    static constexpr int8_t tunedOffsets[16] = { 0, 1, 1, 2, 1, 2, 1, 3, 1, 3, 1, 5, 4, 3, 2, 1 };
+
+    static constexpr Bar solveBar(int rounds) {
+        if (rounds <= 0) {
+            return { 0, 0, 0, false };
+        }
+        if (rounds < W / 2) {
+            uint8_t pitch = W / rounds;
+            int16_t free = W - (rounds * pitch - 1);
+            int16_t offset = (W == 32) ? tunedOffsets[rounds] : (free + 1) / 2;
+            return { offset, pitch, (uint8_t) (pitch - 1), false };
+        }
+        int t = _min(rounds, (int) W);
+        bool gaps = rounds <= W - 2;
+        return { (int16_t) ((W - (t + (gaps ? 2 : 0))) / 2), 1, 1, gaps };
+    }
+
+    static constexpr Bars solveBars() {
+        Bars b = {};
+        for (int rounds = 0; rounds <= W; rounds++) {
+            b.bar[rounds] = solveBar(rounds);
+        }
+        return b;
+    }
+
+    static constexpr Texts texts = solveTexts();
+    static constexpr Bars bars = solveBars();
+};
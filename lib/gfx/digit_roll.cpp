@@ -0,0 +1,157 @@
+// Class DigitRoll - text of fixed cells, e.g. countdown, with changed characters rolled in
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "digit_roll.h"
+
+bool DigitRoll::roll(const char *text, const GFXfont *font, int16_t x, int16_t y, uint16_t color, uint32_t now) {
+    bool same = font == font_ && x == x_ && y == y_ && color == color_ && height_ > 0;
+    if (font != font_) {
+        setFont(font);
+    }
+
+    Cell cells[DIGIT_ROLL_MAX_CELLS];
+    uint8_t count = 0;
+    int16_t cx = x;
+    for (const char *p = text; *p != '\0'; p++) {
+        if (count >= DIGIT_ROLL_MAX_CELLS) {
+            same = false;
+            break;
+        }
+        const GFXglyph *glyph = glyphOf(*p);
+        uint8_t w = (glyph != nullptr) ? pgm_read_byte(&glyph->xAdvance) : 0;
+        cells[count++] = { *p, *p, cx, w, false };
+        cx += w;
+    }
+    same = same && count == cellCount_;
+    for (uint8_t i = 0; same && i < count; i++) {
+        same = cells[i].x == cells_[i].x && cells[i].width == cells_[i].width && cells[i].width <= 8;
+    }
+
+    if (!same) {
+        memcpy(cells_, cells, count * sizeof(Cell));
+        cellCount_ = count;
+        x_ = x;
+        y_ = y;
+        color_ = color;
+        rolling_ = false;
+        return false;
+    }
+
+    update(startMs_ + DIGIT_ROLL_DURATION); // previous roll, if still going, completes first
+    for (uint8_t i = 0; i < count; i++) {
+        if (cells[i].to != cells_[i].to) {
+            cells_[i].from = cells_[i].to;
+            cells_[i].to = cells[i].to;
+            cells_[i].rolling = true;
+            rolling_ = true;
+        }
+    }
+    startMs_ = now;
+    frame_ = 0;
+    return true;
+}
+
+bool DigitRoll::update(uint32_t now) {
+    if (!rolling_) {
+        return false;
+    }
+    uint32_t elapsed = now - startMs_;
+    uint8_t frame = (elapsed >= DIGIT_ROLL_DURATION) ? height_ : (elapsed * height_) / DIGIT_ROLL_DURATION;
+    if (frame == frame_) {
+        return false;
+    }
+    frame_ = frame;
+    gfx_->startWrite();
+    for (uint8_t i = 0; i < cellCount_; i++) {
+        if (cells_[i].rolling) {
+            drawCell(cells_[i]);
+            cells_[i].rolling = frame_ < height_;
+        }
+    }
+    gfx_->endWrite();
+    rolling_ = frame_ < height_;
+    return true;
+}
+
+void DigitRoll::reset() {
+    font_ = nullptr;
+    cellCount_ = 0;
+    rolling_ = false;
+}
+
+// Band height from the characters a countdown consists of, rasters are cached per font
+void DigitRoll::setFont(const GFXfont *font) {
+    font_ = font;
+    cacheCount_ = 0;
+    int8_t top = 0, bottom = 0;
+    bool any = false;
+    for (const char *p = DIGIT_ROLL_CHARSET; *p != '\0'; p++) {
+        const GFXglyph *glyph = glyphOf(*p);
+        if (glyph == nullptr) {
+            continue;
+        }
+        int8_t yo = pgm_read_byte(&glyph->yOffset);
+        int8_t b = yo + pgm_read_byte(&glyph->height);
+        top = any ? _min(top, yo) : yo;
+        bottom = any ? _max(bottom, b) : b;
+        any = true;
+    }
+    top_ = top;
+    height_ = (any && bottom - top <= DIGIT_ROLL_MAX_HEIGHT) ? bottom - top : 0; // too tall to roll
+}
+
+const GFXglyph *DigitRoll::glyphOf(char c) const {
+    uint16_t first = pgm_read_word(&font_->first), last = pgm_read_word(&font_->last);
+    if ((uint8_t) c < first || (uint8_t) c > last) {
+        return nullptr;
+    }
+    return ((const GFXglyph *) pgm_read_pointer(&font_->glyph)) + ((uint8_t) c - first);
+}
+
+const uint8_t *DigitRoll::rasterOf(char c) {
+    for (uint8_t i = 0; i < cacheCount_; i++) {
+        if (cache_[i].c == c) {
+            return cache_[i].rows;
+        }
+    }
+    Raster &r = cache_[(cacheCount_ < DIGIT_ROLL_CACHE_SIZE) ? cacheCount_++ : DIGIT_ROLL_CACHE_SIZE - 1];
+    r.c = c;
+    memset(r.rows, 0, sizeof(r.rows));
+    const GFXglyph *glyph = glyphOf(c);
+    if (glyph == nullptr) {
+        return r.rows;
+    }
+    const uint8_t *bitmap = (const uint8_t *) pgm_read_pointer(&font_->bitmap) + pgm_read_word(&glyph->bitmapOffset);
+    uint8_t gw = pgm_read_byte(&glyph->width), gh = pgm_read_byte(&glyph->height);
+    int8_t xo = pgm_read_byte(&glyph->xOffset), yo = pgm_read_byte(&glyph->yOffset);
+    uint16_t bit = 0;
+    for (uint8_t gy = 0; gy < gh; gy++) {
+        int16_t row = yo - top_ + gy;
+        for (uint8_t gx = 0; gx < gw; gx++, bit++) {
+            int16_t col = xo + gx;
+            if ((pgm_read_byte(&bitmap[bit >> 3]) & (0x80 >> (bit & 7))) && row >= 0 && row < height_ && col >= 0 && col < 8) {
+                r.rows[row] |= 1 << col;
+            }
+        }
+    }
+    return r.rows;
+}
+
+// Rows of the band at the current frame, frame_ rows of the new raster already in
+void DigitRoll::drawCell(const Cell &cell) {
+    uint8_t from[DIGIT_ROLL_MAX_HEIGHT];
+    memcpy(from, rasterOf(cell.from), sizeof(from)); // a full cache may reuse the entry for the other
+    const uint8_t *to = rasterOf(cell.to);
+    for (uint8_t r = 0; r < height_; r++) {
+        uint8_t bits;
+        if (direction_ == DIGIT_ROLL_DOWN) {
+            bits = (r < frame_) ? to[height_ - frame_ + r] : from[r - frame_];
+        } else {
+            bits = (r < height_ - frame_) ? from[r + frame_] : to[r - (height_ - frame_)];
+        }
+        for (uint8_t c = 0; c < cell.width; c++) {
+            gfx_->writePixel(cell.x + c, y_ + top_ + r, (bits >> c) & 1 ? color_ : 0);
+        }
+    }
+}
@@ -0,0 +1,77 @@
+// Class DigitRoll - text of fixed cells, e.g. countdown, with changed characters rolled in
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+#define DIGIT_ROLL_MAX_CELLS 10
+#define DIGIT_ROLL_MAX_HEIGHT 8
+#define DIGIT_ROLL_CACHE_SIZE 16
+#define DIGIT_ROLL_DURATION 200     // milliseconds per roll
+#define DIGIT_ROLL_CHARSET "-/0123456789:"  // characters the band height is taken from
+
+enum DigitRollDirection : uint8_t {
+    DIGIT_ROLL_UP,      // new character comes from below
+    DIGIT_ROLL_DOWN     // new character comes from above
+};
+
+// Each character of the text occupies a cell of its advance width and of the band
+// height common to the font. When a text comes with the same cell layout as the one
+// shown, only the cells whose character changed get redrawn, row by row rolling from
+// the old character raster to the new one, both cached as row bitmasks. Frames are
+// driven by update() from the render loop, by time elapsed, so a roll keeps its
+// duration however often it is called.
+class DigitRoll {
+public:
+    DigitRoll(Adafruit_GFX *gfx, DigitRollDirection direction = DIGIT_ROLL_DOWN) : gfx_(gfx), direction_(direction) {};
+
+    // Starts rolling the changed cells and returns true, if the text keeps the cell
+    // layout (font, position, color and advances) of the one shown. Otherwise returns
+    // false and the caller has to draw the text whole. Either way the text is taken
+    // as shown from now on.
+    bool roll(const char *text, const GFXfont *font, int16_t x, int16_t y, uint16_t color, uint32_t now);
+
+    // Draws the frames due of the cells rolling, returns true if anything was drawn
+    bool update(uint32_t now);
+
+    // Forget the text shown (the canvas has been drawn over), next roll() returns false
+    void reset();
+
+    inline bool isRolling() const { return rolling_; }
+
+private:
+    struct Cell {
+        char from, to;
+        int16_t x;
+        uint8_t width;
+        bool rolling;
+    };
+    struct Raster {
+        char c;
+        uint8_t rows[DIGIT_ROLL_MAX_HEIGHT];    // bit n = column n of the cell
+    };
+
+    Adafruit_GFX *gfx_;
+    DigitRollDirection direction_;
+    const GFXfont *font_ = nullptr;
+    int16_t x_ = 0, y_ = 0;
+    uint16_t color_ = 0;
+    int8_t top_ = 0;        // band top, relative to the baseline
+    uint8_t height_ = 0;    // band height
+    Cell cells_[DIGIT_ROLL_MAX_CELLS];
+    uint8_t cellCount_ = 0;
+    bool rolling_ = false;
+    uint32_t startMs_ = 0;
+    uint8_t frame_ = 0;     // rows rolled, of height_
+
+    Raster cache_[DIGIT_ROLL_CACHE_SIZE];
+    uint8_t cacheCount_ = 0;
+
+    void setFont(const GFXfont *font);
+    const GFXglyph *glyphOf(char c) const;
+    const uint8_t *rasterOf(char c);
+    void drawCell(const Cell &cell);
+};
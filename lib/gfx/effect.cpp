@@ -0,0 +1,74 @@
+// Class Effect - color effects over a clip area, driven by precomputed tables, for use with Compositor
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "effect.h"
+
+static inline uint8_t lerp(uint8_t a, uint8_t b, uint8_t amount) {
+    return a + ((int16_t) (b - a) * amount) / 255;
+}
+
+void Effect::set(EffectType type, uint16_t periodMs, CRGB from, CRGB to) {
+    type_ = type;
+    periodMs_ = periodMs;
+    switch (type) {
+        case EFFECT_RAINBOW:
+            for (uint16_t i = 0; i < 256; i++) {
+                hsv2rgb_rainbow(CHSV(i, 255, 255), table_.colors[i]);
+            }
+            break;
+        case EFFECT_PULSE:
+            for (uint16_t i = 0; i < 256; i++) {
+                table_.levels[i] = EFFECT_PULSE_MIN + ((sin8(i) * (255 - EFFECT_PULSE_MIN)) >> 8);
+            }
+            break;
+        case EFFECT_GRADIENT:
+            // there and back, so that a moving gradient wraps around seamlessly
+            for (uint16_t i = 0; i < 128; i++) {
+                uint8_t amount = (i * 255) / 127;
+                table_.colors[i] = CRGB(lerp(from.r, to.r, amount), lerp(from.g, to.g, amount), lerp(from.b, to.b, amount));
+                table_.colors[255 - i] = table_.colors[i];
+            }
+            break;
+        default:
+            break;
+    }
+    updateStep();
+    changed_ = true;
+}
+
+void Effect::setClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+    clipX0_ = x;
+    clipY0_ = y;
+    clipX1_ = x + w - 1;
+    clipY1_ = y + h - 1;
+    updateStep();
+    changed_ = true;
+}
+
+void Effect::getClip(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1) const {
+    *x0 = clipX0_;
+    *y0 = clipY0_;
+    *x1 = clipX1_;
+    *y1 = clipY1_;
+}
+
+bool Effect::advance(uint32_t now) {
+    uint8_t phase = (type_ != EFFECT_NONE && periodMs_ > 0) ? ((now % periodMs_) * 256) / periodMs_ : 0;
+    bool changed = changed_ || (type_ != EFFECT_NONE && phase != phase_);
+    phase_ = phase;
+    changed_ = false;
+    return changed;
+}
+
+// Rainbow spans the clip width once, gradient goes from one color to the other across it
+void Effect::updateStep() {
+    int32_t w = clipX1_ - clipX0_ + 1;
+    uint32_t step = 0;
+    if (type_ == EFFECT_RAINBOW && w > 0) {
+        step = (256UL << 8) / w;
+    } else if (type_ == EFFECT_GRADIENT && w > 1) {
+        step = (127UL << 8) / (w - 1);
+    }
+    step_ = _min(step, 0xFFFFUL);
+}
@@ -0,0 +1,73 @@
+// Class Effect - color effects over a clip area, driven by precomputed tables, for use with Compositor
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#define EFFECT_DEFAULT_PERIOD 2000  // milliseconds per effect cycle
+#define EFFECT_PULSE_MIN 48         // lowest brightness of the pulse
+
+class Layer;
+
+enum EffectType : uint8_t {
+    EFFECT_NONE,
+    EFFECT_RAINBOW,     // hues along x, replaces the colors
+    EFFECT_PULSE,       // breathing brightness of the colors
+    EFFECT_GRADIENT     // two colors blended along x, replaces the colors
+};
+
+// The whole cycle of an effect is precomputed into a 256 entry table once, when set,
+// so per pixel there is just a table lookup and 8-bit fixed point math: the phase
+// (table offset) moves with time once per frame, the column adds a fixed point offset.
+// Pixels of the clip area are recolored, with a target layer set only those where
+// the target layer shows a color (i.e. text only on a text layer).
+class Effect {
+public:
+    // With periodMs 0 the effect stands still.
+    void set(EffectType type, uint16_t periodMs = EFFECT_DEFAULT_PERIOD, CRGB from = CRGB::Red, CRGB to = CRGB::Blue);
+    void setClip(int16_t x, int16_t y, int16_t w, int16_t h);
+    void setTarget(const Layer *layer) { target_ = layer; changed_ = true; }
+
+    inline EffectType type() const { return type_; }
+    inline const Layer *target() const { return target_; }
+    inline bool covers(int16_t x, int16_t y) const {
+        return type_ != EFFECT_NONE && x >= clipX0_ && x <= clipX1_ && y >= clipY0_ && y <= clipY1_;
+    }
+    // Clip area, inclusive coordinates
+    void getClip(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1) const;
+
+    // Moves the phase to the time given, true if the pixels need recoloring
+    bool advance(uint32_t now);
+
+    inline CRGB apply(CRGB color, int16_t x) const {
+        uint8_t i = phase_ + (uint8_t) (((uint16_t) (x - clipX0_) * step_) >> 8);
+        switch (type_) {
+            case EFFECT_PULSE:
+                return color.nscale8_video(table_.levels[phase_]);
+            case EFFECT_RAINBOW:
+            case EFFECT_GRADIENT:
+                return table_.colors[i];
+            default:
+                return color;
+        }
+    }
+
+private:
+    EffectType type_ = EFFECT_NONE;
+    uint16_t periodMs_ = EFFECT_DEFAULT_PERIOD;
+    int16_t clipX0_ = 0, clipY0_ = 0, clipX1_ = -1, clipY1_ = -1;
+    uint16_t step_ = 0;     // table entries per column, 8.8 fixed point
+    uint8_t phase_ = 0;
+    bool changed_ = false;
+    const Layer *target_ = nullptr;
+    union Table {
+        Table() {}
+        CRGB colors[256];       // rainbow, gradient
+        uint8_t levels[256];    // pulse
+    } table_;
+
+    void updateStep();
+};
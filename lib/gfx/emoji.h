@@ -0,0 +1,134 @@
+// Sprite atlas Emoji
+// Generated by tools/fontc.py from emoji.txt
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <utf832bitfont.h>
+#include <sprite_atlas.h>
+#include <grapheme_composer.h>
+
+inline constexpr uint8_t EmojiSprites[] PROGMEM = {
+    0x07, 0x50, 0x07, 0x00, 0x07, 0x30, 0x07, 0x20,   // 0 to 7
+    0x07, 0x10, 0x07, 0x40, 0x17, 0x50, 0x17, 0x40,   // 8 to 15
+    0x07, 0x10, 0x07, 0x10, 0x18, 0x30, 0x38, 0x30,   // 16 to 23
+    0x18, 0x80, 0x14, 0x10, 0x14, 0x00, 0xf4, 0x00,   // 24 to 31
+    0x54, 0x20, 0x34, 0x40, 0x14, 0xa0, 0x00, 0x52,   // 32 to 39
+    0x00, 0x02, 0x11, 0x12, 0x11, 0x12, 0x11, 0x12,   // 40 to 47
+    0x11, 0x32, 0x11, 0x52, 0x11, 0x32, 0x11, 0x12,   // 48 to 55
+    0x11, 0x12, 0x11, 0x12, 0x11, 0x02, 0x00, 0x52,   // 56 to 63
+    0x00, 0x83, 0x00, 0x33, 0x00, 0x13, 0x00, 0x33,   // 64 to 71
+    0x00, 0x03, 0x00, 0x53, 0x20, 0x33, 0x40, 0x13,   // 72 to 79
+    0x40, 0x35, 0x20, 0x55, 0x00, 0x20, 0x06, 0x50,   // 80 to 87
+    0x16, 0x50, 0x16, 0x30, 0x66, 0x00, 0x06, 0x00,   // 88 to 95
+    0x66, 0x00, 0x46, 0x00, 0x06, 0x00, 0x66, 0x10,   // 96 to 103
+    0x36, 0x00, 0x20, 0x04, 0x50, 0x14, 0x10, 0x04,   // 104 to 111
+    0x10, 0x24, 0x00, 0x14, 0x10, 0x14, 0x05, 0x04,   // 112 to 119
+    0x05, 0x04, 0x00, 0x14, 0x15, 0x03, 0x05, 0x24,   // 120 to 127
+    0x15, 0x23, 0x05, 0x14, 0x05, 0x33, 0x05, 0x04,   // 128 to 135
+    0x00, 0x14, 0x13, 0x14, 0x00, 0x10, 0x33, 0x20,   // 136 to 143
+    0x53, 0x00, 0x13, 0x01, 0x13, 0x01, 0x33, 0x01,   // 144 to 151
+    0x13, 0x01, 0xa3, 0x01, 0x32, 0x01, 0x03, 0x00,   // 152 to 159
+    0x03, 0x31, 0x03, 0x20, 0x33, 0x10, 0xf4, 0xf2,   // 160 to 167
+    0xf4, 0x21, 0x13, 0x24, 0x21, 0x13, 0x24, 0x21,   // 168 to 175
+    0x13, 0x24, 0x21, 0x13, 0x24, 0x21, 0x13, 0x24,   // 176 to 183
+    0x21, 0x13, 0x24, 0xa4, 0x12, 0x34, 0x52, 0x14,   // 184 to 191
+    0x52, 0x34, 0x12, 0xa4, 0x09, 0x62, 0x29, 0x42,   // 192 to 199
+    0x39, 0x32, 0x39, 0x34, 0x29, 0x44, 0x09, 0x64,   // 200 to 207
+    0xf1, 0xf4, 0xf3, 0x14, 0x02, 0x64, 0x02, 0x44,   // 208 to 215
+    0x72, 0x14, 0x02, 0x64, 0x02, 0x64, 0x02, 0x44,   // 216 to 223
+    0x74, 0xf3, 0xf3, 0x74, 0x29, 0x12, 0x24, 0x29,   // 224 to 231
+    0x12, 0x24, 0x29, 0x12, 0x24, 0x29, 0x12, 0x24,   // 232 to 239
+    0x29, 0x12, 0x24, 0x29, 0x12, 0x24, 0x04, 0x19,   // 240 to 247
+    0x02, 0x04, 0x02, 0x09, 0x04, 0x09, 0x02, 0x09,   // 248 to 255
+    0x02, 0x04, 0x12, 0x09, 0x32, 0x04, 0x22, 0x74,   // 256 to 263
+    0x09, 0x02, 0x09, 0x02, 0x04, 0x12, 0x09, 0x04,   // 264 to 271
+    0x19, 0x02, 0x04, 0x02, 0x09, 0x04, 0xf4, 0xf2,   // 272 to 279
+    0xfa, 0x2a, 0x12, 0x25, 0x2a, 0x12, 0x25, 0x2a,   // 280 to 287
+    0x12, 0x25, 0x2a, 0x12, 0x25, 0x2a, 0x12, 0x25,   // 288 to 295
+    0x2a, 0x12, 0x25, 0x2a, 0x12, 0x24, 0x2a, 0x12,   // 296 to 303
+    0x24, 0x2a, 0x12, 0x24, 0x2a, 0x12, 0x24, 0x2a,   // 304 to 311
+    0x12, 0x24, 0x2a, 0x12, 0x24, 0xf4, 0xf2, 0xf9,   // 312 to 319
+    0xf2, 0x72, 0xf4, 0x74, 0x19, 0x03, 0x69, 0x03,   // 320 to 327
+    0x49, 0x73, 0x19, 0x03, 0x69, 0x03, 0x69, 0x03,   // 328 to 335
+    0x49, 0x82, 0x04, 0x02, 0x04, 0x32, 0x09, 0x24,   // 336 to 343
+    0x49, 0x02, 0x04, 0x02, 0x39, 0xf4, 0xf9, 0x79,   // 344 to 351
+    0xf3, 0x73, 0x09, 0x02, 0x09, 0x02, 0x34, 0x02,   // 352 to 359
+    0x09, 0x02, 0x09, 0x32, 0x09, 0x02, 0x09, 0x02,   // 360 to 367
+    0x34, 0x72, 0x74, 0x72,   // 368 to 371
+};
+
+inline constexpr uint8_t EmojiPalette[] PROGMEM = {
+    0x00, 0x00, 0x00,   // '.', transparent
+    0x00, 0x00, 0x00,   // 'K'
+    0xff, 0xff, 0xff,   // 'W'
+    0xff, 0xc8, 0x00,   // 'Y'
+    0xff, 0x00, 0x00,   // 'R'
+    0xff, 0x60, 0x00,   // 'O'
+    0xff, 0xa0, 0x60,   // 'S'
+    0xa0, 0xa0, 0xb0,   // 'B'
+    0x80, 0x40, 0x00,   // 'N'
+    0x00, 0x30, 0xc0,   // 'U'
+    0x00, 0xa0, 0x40,   // 'G'
+};
+
+inline constexpr GFXglyph EmojiGlyphs[] PROGMEM = {
+    {   0, 8, 8, 9, 0, -7 },   // '⚔'
+    {  25, 8, 8, 9, 0, -7 },   // '❤'
+    {  38, 8, 8, 9, 0, -7 },   // '🎲'
+    {  65, 8, 8, 9, 0, -7 },   // '🏆'
+    {  85, 8, 8, 9, 0, -7 },   // '👍'
+    { 106, 8, 8, 9, 0, -7 },   // '🔥'
+    { 141, 8, 8, 9, 0, -7 },   // '😀'
+    { 166, 8, 6, 9, 0, -6 },   // flag AT
+    { 169, 8, 6, 9, 0, -6 },   // flag BE
+    { 187, 8, 6, 9, 0, -6 },   // flag CH
+    { 196, 8, 6, 9, 0, -6 },   // flag CZ
+    { 208, 8, 6, 9, 0, -6 },   // flag DE
+    { 211, 8, 6, 9, 0, -6 },   // flag DK
+    { 224, 8, 6, 9, 0, -6 },   // flag ES
+    { 228, 8, 6, 9, 0, -6 },   // flag FR
+    { 246, 8, 6, 9, 0, -6 },   // flag GB
+    { 278, 8, 6, 9, 0, -6 },   // flag HU
+    { 281, 8, 6, 9, 0, -6 },   // flag IE
+    { 299, 8, 6, 9, 0, -6 },   // flag IT
+    { 317, 8, 6, 9, 0, -6 },   // flag NL
+    { 320, 8, 6, 9, 0, -6 },   // flag PL
+    { 324, 8, 6, 9, 0, -6 },   // flag SE
+    { 337, 8, 6, 9, 0, -6 },   // flag SK
+    { 350, 8, 6, 9, 0, -6 },   // flag UA
+    { 354, 8, 6, 9, 0, -6 },   // flag US
+};
+
+inline constexpr SpriteAtlas EmojiAtlas = { EmojiSprites, EmojiPalette, 11 };
+
+// Flags AT BE CH CZ DE DK ES FR GB HU IE IT NL PL SE SK UA US, regional indicator pairs composed by GraphemeComposer
+inline constexpr uint8_t EmojiFlagIndex[26] PROGMEM = {
+    0, 1, 2, 4, 6, 7, 8, 9, 10, 12, 12, 12, 12, 12, 13, 13, 14, 14, 14, 16, 16, 18, 18, 18, 18, 18
+};
+
+inline constexpr uint32_t EmojiFlagLetters[26] PROGMEM = {
+    0x0080000, 0x0000010, 0x2000080, 0x0000410, 0x0040000, 0x0020000, 0x0000002, 0x0100000,   // A to H
+    0x0080010, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000800, 0x0000000, 0x0000800,   // I to P
+    0x0000000, 0x0000000, 0x0000410, 0x0000000, 0x0040001, 0x0000000, 0x0000000, 0x0000000,   // Q to X
+    0x0000000, 0x0000000,   // Y to Z
+};
+
+inline constexpr FlagTable EmojiFlags = { 0xF0000, EmojiFlagIndex, EmojiFlagLetters };
+
+// Segments to be listed in a UTF8_32BitFont, so its text can hold the sprites inline
+#define EMOJI_SEGMENTS \
+    { (uint8_t *) EmojiSprites, (GFXglyph *) &EmojiGlyphs[0], 9876, 9876, 9, 0, 0 }, \
+    { (uint8_t *) EmojiSprites, (GFXglyph *) &EmojiGlyphs[1], 10084, 10084, 9, 0, 0 }, \
+    { (uint8_t *) EmojiSprites, (GFXglyph *) &EmojiGlyphs[2], 0, 0, 9, 127922, 127922 }, \
+    { (uint8_t *) EmojiSprites, (GFXglyph *) &EmojiGlyphs[3], 0, 0, 9, 127942, 127942 }, \
+    { (uint8_t *) EmojiSprites, (GFXglyph *) &EmojiGlyphs[4], 0, 0, 9, 128077, 128077 }, \
+    { (uint8_t *) EmojiSprites, (GFXglyph *) &EmojiGlyphs[5], 0, 0, 9, 128293, 128293 }, \
+    { (uint8_t *) EmojiSprites, (GFXglyph *) &EmojiGlyphs[6], 0, 0, 9, 128512, 128512 }, \
+    { (uint8_t *) EmojiSprites, (GFXglyph *) &EmojiGlyphs[7], 0, 0, 9, 983040, 983057 }, \
+
+inline constexpr UTF8_32BitFont Emoji[] PROGMEM = {
+    EMOJI_SEGMENTS
+    {nullptr, nullptr, 0, 0, 0, 0, 0}
+};
@@ -1,605 +1,597 @@
+// Bitmap font F3x5, F3x5_Fixed
+// Generated by tools/fontc.py from f3x5.txt, f3x5_fixed.txt
+// WTFPL license applies
+
 #pragma once
 
 #include <Arduino.h>
 #include <utf832bitfont.h>
+#include <emoji.h>
 
-const uint8_t F3x5Bitmaps[] PROGMEM = {
-    0b00100001, 0b00101010, 0b11100010, 0b00101011, 0b11011011, 0b11100101, 0b01001111, 0b00100011,   // 0 to 7
-    0b10101010, 0b01000010, 0b00101000, 0b01010110, 0b01011101, 0b00100010, 0b10001011, 0b11011011,   // 8 to 15
-    0b11101001, 0b00100100, 0b10101001, 0b11100011, 0b10100001, 0b00100100, 0b11110100, 0b00101011,   // 16 to 23
-    0b01011101, 0b01010100, 0b00100100, 0b10100011, 0b10100101, 0b11010001, 0b11011111, 0b00101110,   // 24 to 31
-    0b11010110, 0b11011010, 0b01110001, 0b00011100, 0b10001000, 0b01100101, 0b01010101, 0b11100011,   // 32 to 39
-    0b10101010, 0b01100010, 0b10010000, 0b10011001, 0b10010010, 0b01100100, 0b00001001, 0b00101010,   // 40 to 47
-    0b00101001, 0b11100011, 0b10110110, 0b11010111, 0b01011010, 0b10101000, 0b01101011, 0b01010111,   // 48 to 55
-    0b01011101, 0b00100011, 0b01101010, 0b01100101, 0b11010101, 0b01100100, 0b11010110, 0b11011010,   // 56 to 63
-    0b10101011, 0b01011011, 0b01010100, 0b01110101, 0b11000101, 0b01001111, 0b10110101, 0b00101000,   // 64 to 71
-    0b01111001, 0b00101011, 0b10100101, 0b11100001, 0b00101000, 0b01101011, 0b01000001, 0b01000110,   // 72 to 79
-    0b11000100, 0b01111110, 0b00110110, 0b01001000, 0b10101000, 0b00111001, 0b00101011, 0b01011011,   // 80 to 87
-    0b01010100, 0b01001101, 0b01010100, 0b01011111, 0b01010111, 0b11011010, 0b01111101, 0b10010010,   // 88 to 95
-    0b01001110, 0b10111010, 0b10011001, 0b10011001, 0b10101001, 0b01011111, 0b01110101, 0b01011110,   // 96 to 103
-    0b01110101, 0b10010010, 0b11101010, 0b10110111, 0b01011010, 0b10010001, 0b01010100, 0b00011010,   // 104 to 111
-    0b10110110, 0b11101001, 0b00101110, 0b10101000, 0b00100100, 0b10001011, 0b10100101, 0b11100001,   // 112 to 119
-    0b01011111, 0b01110010, 0b11010110, 0b10100011, 0b11101001, 0b11100011, 0b01011011, 0b01011001,   // 120 to 127
-    0b00101110, 0b11110011, 0b01001110, 0b10101010, 0b11111011, 0b01010111, 0b11101001, 0b11101010,   // 128 to 135
-    0b11111011, 0b01110010, 0b00111110, 0b01111001, 0b11110111, 0b01010101, 0b01011111, 0b01000101,   // 136 to 143
-    0b01100010, 0b10101011, 0b01011011, 0b10111011, 0b01011010, 0b01010100, 0b00100100, 0b10011110,   // 144 to 151
-    0b01111001, 0b11100101, 0b00101000, 0b00111001, 0b00101010, 0b11111011, 0b01110001, 0b11101001,   // 152 to 159
-    0b00100101, 0b00101000, 0b01010100, 0b10001010, 0b11111011, 0b01110010, 0b01000110, 0b10110111,   // 160 to 167
-    0b10100101, 0b10101001, 0b01010101, 0b01110001, 0b01010100, 0b01110111, 0b10010010, 0b11101010,   // 168 to 175
-    0b01111010, 0b11111010, 0b10110110, 0b10110111, 0b10101010, 0b01110110, 0b11000111, 0b10110111,   // 176 to 183
-    0b11110110, 0b11111110, 0b11010101, 0b11101010, 0b11110110, 0b11011110, 0b01110010, 0b11010111,   // 184 to 191
-    0b01011101, 0b01101010, 0b01001111, 0b00100111, 0b10010101, 0b10101010, 0b11000001, 0b00001101,   // 192 to 199
-    0b00001010, 0b01001100, 0b00010000, 0b10001010, 0b01001011, 0b00010010, 0b00110000, 0b10000000,   // 200 to 207
-    0b10101101, 0b01011101, 0b01011010, 0b10000000, 0b10000001, 0b00010001, 0b00000011, 0b10000000,   // 208 to 215
-    0b10001010, 0b01001010, 0b00110001, 0b00010101, 0b11100100, 0b01000010, 0b10000000, 0b10101010,   // 216 to 223
-    0b10101010, 0b11110001, 0b10101110, 0b11101110, 0b11110001, 0b10100010, 0b11010110, 0b01011000,   // 224 to 231
-    0b01010100, 0b00111110, 0b01011000, 0b10101000, 0b00111110, 0b01011000, 0b01000001, 0b11011110,   // 232 to 239
-    0b01011000, 0b00101000, 0b00111110, 0b01011000, 0b01010100, 0b01010110, 0b01011000, 0b10101000,   // 240 to 247
-    0b01010110, 0b01011000, 0b10101010, 0b10001010, 0b10101000, 0b11111110, 0b11011010, 0b01010101,   // 248 to 255
-    0b11001100, 0b11000000, 0b01111010, 0b10111010, 0b01110000, 0b10101101, 0b11011101, 0b10100000,   // 256 to 263
-    0b10101011, 0b10011101, 0b01010000, 0b10101010, 0b10101111, 0b00010000, 0b10101110, 0b11101111,   // 264 to 271
-    0b00010000, 0b10000010, 0b01001000, 0b00110000, 0b10010101, 0b10010000, 0b10010000, 0b10101001,   // 272 to 279
-    0b10100000, 0b10100000, 0b01000010, 0b11110010, 0b01000000, 0b01010100, 0b01111011, 0b11000000,   // 280 to 287
-    0b11100011, 0b11011011, 0b11000000, 0b10100011, 0b11011011, 0b11000000, 0b10001000, 0b01011010,   // 288 to 295
-    0b11000000, 0b00101000, 0b01011010, 0b11000000, 0b01010100, 0b01011010, 0b11000000, 0b10100010,   // 296 to 303
-    0b11011010, 0b11000000, 0b10001011, 0b00011110, 0b11000000, 0b00101011, 0b00011110, 0b11000000,   // 304 to 311
-    0b01010111, 0b00011110, 0b11000000, 0b11100011, 0b00011110, 0b11000000, 0b10100011, 0b00011110,   // 312 to 319
-    0b11000000, 0b01010101, 0b01110110, 0b11000000, 0b10001001, 0b11111000, 0b11000000, 0b00101001,   // 320 to 327
-    0b11111000, 0b11000000, 0b01010101, 0b11111000, 0b11000000, 0b10100001, 0b11111000, 0b11000000,   // 328 to 335
-    0b10001000, 0b01111011, 0b11000000, 0b00101000, 0b01111011, 0b11000000, 0b10101011, 0b00011110,   // 336 to 343
-    0b11000000, 0b00101001, 0b11001000, 0b11000000, 0b00101000, 0b00111000, 0b11000000, 0b01010101,   // 344 to 351
-    0b11001000, 0b11000000, 0b01010100, 0b00111000, 0b11000000, 0b01000001, 0b11001000, 0b11000000,   // 352 to 359
-    0b10101001, 0b11001000, 0b11000000, 0b10101000, 0b00111000, 0b11000000, 0b11100011, 0b11101001,   // 360 to 367
-    0b11000000, 0b11100001, 0b11111000, 0b11000000, 0b10101011, 0b11101001, 0b11000000, 0b10101001,   // 368 to 375
-    0b11111000, 0b11000000, 0b01000011, 0b11101001, 0b11000000, 0b01000001, 0b11111000, 0b11000000,   // 376 to 383
-    0b01010101, 0b11001010, 0b11000000, 0b10101001, 0b11001010, 0b11000000, 0b01000001, 0b11001010,   // 384 to 391
-    0b11000000, 0b11100011, 0b10100101, 0b11000000, 0b11100001, 0b00101000, 0b11000000, 0b10101000,   // 392 to 399
-    0b01110101, 0b11000000, 0b01000011, 0b10100101, 0b11000000, 0b00101000, 0b01001001, 0b11000000,   // 400 to 407
-    0b00110110, 0b01001001, 0b11000000, 0b10101011, 0b11011011, 0b11000000, 0b10101000, 0b01111011,   // 408 to 415
-    0b11000000, 0b10101011, 0b01011101, 0b01000000, 0b10101011, 0b10100100, 0b10000000, 0b11100010,   // 416 to 423
-    0b11011010, 0b11000000, 0b10101000, 0b01011010, 0b11000000, 0b01010101, 0b01011010, 0b11000000,   // 424 to 431
-    0b01010101, 0b00001010, 0b11000000, 0b10110110, 0b11010110, 0b10000000, 0b01010100, 0b01011111,   // 432 to 439
-    0b11000000, 0b01010100, 0b01010100, 0b10000000, 0b10100010, 0b11010100, 0b10000000, 0b00101011,   // 440 to 447
-    0b10010101, 0b11000000, 0b01000011, 0b10010101, 0b11000000, 0b10101011, 0b10010101, 0b11000000,   // 448 to 455
-    0b01110110, 0b11011111, 0b01000000, 0b10101000, 0b01011111, 0b01000000, 0b00101000, 0b01011101,   // 456 to 463
-    0b01000000, 0b10001000, 0b01011111, 0b01000000, 0b11110011, 0b11001111, 0b01111011, 0b10100111,   // 464 to 471
-    0b10101101, 0b11011010, 0b01100110, 0b10111011, 0b10101110, 0b10111011, 0b10111110, 0b11111010,   // 472 to 479
-    0b10000101, 0b01000010, 0b10000100, 0b01110110, 0b11011100, 0b11000101, 0b00011100, 0b11110011,   // 480 to 487
-    0b00011100, 0b01110011, 0b11011100, 0b11000101, 0b00000100, 0b11010110, 0b11011100, 0b11110011,   // 488 to 495
-    0b01001000, 0b10110111, 0b11011010, 0b11010111, 0b01001000, 0b10110110, 0b11110100, 0b10110110,   // 496 to 503
-    0b11111010, 0b10110101, 0b01011010, 0b10001001, 0b00010010, 0b10011010, 0b11011100, 0b01101011,   // 504 to 511
-    0b10100100, 0b01110111, 0b10010110, 0b10010011, 0b01011010, 0b10110101, 0b10010110, 0b01101010,   // 512 to 519
-    0b00100110, 0b11001000, 0b10101100, 0b11111110, 0b11111110, 0b01010011, 0b01001110, 0b01011101,   // 520 to 527
-    0b00001110, 0b00111111, 0b11111000, 0b10011010, 0b11101000, 0b01110010, 0b00110100, 0b01000011,   // 528 to 535
-    0b10000100, 0b11000111, 0b10110010, 0b01111110, 0b00110100, 0b10011010, 0b01101010, 0b10010010,   // 536 to 543
-    0b11001110, 0b10010010, 0b11000100, 0b11010110, 0b11010100, 0b01110010, 0b01000100, 0b01111000,   // 544 to 551
-    0b11100100, 0b10000000, 0b11101011, 0b10100100, 0b10110110, 0b10110100, 0b01010110, 0b01001000,   // 552 to 559
-    0b11110011, 0b01011100, 0b11110010, 0b01001000, 0b10111111, 0b11011010, 0b01101110, 0b11011010,   // 560 to 567
-    0b11110110, 0b11011010, 0b01011111, 0b11110100, 0b10110111, 0b10010010, 0b10110110, 0b11111110,   // 568 to 575
-    0b11001001, 0b00110110, 0b10110111, 0b11011110, 0b11100000, 0b10010011, 0b01011100, 0b11000101,   // 576 to 583
-    0b10011100, 0b01110101, 0b11011010, 0b01110011, 0b01010100, 0b01110110, 0b11111010, 0b10001111,   // 584 to 591
-    0b11000110, 0b10101111, 0b11000110, 0b10010011, 0b01010010, 0b11100001, 0b00100100, 0b10110110,   // 592 to 599
-    0b11011010, 0b01011101, 0b00100100, 0b01011101, 0b01110100, 0b10110110, 0b10001010, 0b11001101,   // 600 to 607
-    0b00000100, 0b11011111, 0b01001000, 0b10101011, 0b10101010, 0b10101011, 0b01010100, 0b11001100,   // 608 to 615
-    0b11100000, 0b10111010, 0b11010000, 0b10111110, 0b11010000, 0b10110101, 0b01000000, 0b01011111,   // 616 to 623
-    0b10100000, 0b10111100, 0b10010000, 0b11001001, 0b10110000, 0b01111010, 0b00110000, 0b11101110,   // 624 to 631
-    0b01000000, 0b01000101, 0b11000000, 0b11011101, 0b11000000,   // 632 to 636
+inline constexpr uint8_t F3x5Bitmaps[] PROGMEM = {
+    0b00101011, 0b00011110, 0b11101001, 0b00100100, 0b10001001, 0b11111000, 0b11000101, 0b00011100,   // 0 to 7
+    0b00101000, 0b01111011, 0b11110011, 0b01001000, 0b00101000, 0b01010110, 0b01011101, 0b00100010,   // 8 to 15
+    0b10100001, 0b11111000, 0b11010111, 0b01011100, 0b00101001, 0b11001000, 0b11010111, 0b01001000,   // 16 to 23
+    0b00101000, 0b00111000, 0b11100101, 0b01001111, 0b00100011, 0b01101010, 0b01100101, 0b11010101,   // 24 to 31
+    0b01100100, 0b11010110, 0b00101000, 0b00111110, 0b01011111, 0b10101001, 0b11001010, 0b11110110,   // 32 to 39
+    0b11011010, 0b10101000, 0b00100100, 0b10010010, 0b01100100, 0b00001001, 0b01010101, 0b01011111,   // 40 to 47
+    0b01010111, 0b11101001, 0b11011011, 0b00101000, 0b01001001, 0b11100100, 0b10101000, 0b00111110,   // 48 to 55
+    0b01011010, 0b01010100, 0b00011010, 0b10001010, 0b11111011, 0b01110001, 0b01010100, 0b01110101,   // 56 to 63
+    0b11011010, 0b00101011, 0b01011011, 0b01010100, 0b00111000, 0b11000111, 0b10110010, 0b00101000,   // 64 to 71
+    0b01101011, 0b01000001, 0b11001000, 0b11110110, 0b11110000, 0b10101000, 0b01101011, 0b01000011,   // 72 to 79
+    0b11101001, 0b11101011, 0b10100100, 0b10001000, 0b01100101, 0b01010101, 0b11001010, 0b11110011,   // 80 to 87
+    0b01011100, 0b10101011, 0b11011011, 0b11000000, 0b10101000, 0b01111011, 0b11000000, 0b00101011,   // 88 to 95
+    0b01011101, 0b01110101, 0b10010011, 0b01011010, 0b00101000, 0b00111001, 0b00100011, 0b10101010,   // 96 to 103
+    0b01000010, 0b01111010, 0b11111010, 0b10111110, 0b11111010, 0b10101011, 0b01011101, 0b01010100,   // 104 to 111
+    0b00111110, 0b01011110, 0b01110100, 0b10101000, 0b00111001, 0b00100001, 0b00101010, 0b11100010,   // 112 to 119
+    0b01110101, 0b01011110, 0b00101001, 0b11100011, 0b10100101, 0b11011110, 0b11100000, 0b10101001,   // 120 to 127
+    0b11100011, 0b10100011, 0b00011110, 0b11000101, 0b01001111, 0b10110101, 0b10010110, 0b10101011,   // 128 to 135
+    0b10100100, 0b10001000, 0b01111011, 0b11010110, 0b11011100, 0b10101000, 0b01011010, 0b11000000,   // 136 to 143
+    0b01010100, 0b01010110, 0b01011101, 0b00100100, 0b10100010, 0b11010100, 0b10101011, 0b00011110,   // 144 to 151
+    0b11111110, 0b11011010, 0b00101011, 0b10010101, 0b11000000, 0b10101011, 0b10010101, 0b11000000,   // 152 to 159
+    0b01110110, 0b11011111, 0b01001000, 0b10101010, 0b10101010, 0b11110001, 0b10101110, 0b11101110,   // 160 to 167
+    0b11110001, 0b10101011, 0b10011101, 0b01010100, 0b01011111, 0b01010111, 0b11011010, 0b01010100,   // 168 to 175
+    0b00100100, 0b10100011, 0b11101001, 0b11000001, 0b00001101, 0b00001010, 0b01001100, 0b00010101,   // 176 to 183
+    0b11100100, 0b01000010, 0b11110010, 0b01001000, 0b10101000, 0b01011111, 0b01000001, 0b11001010,   // 184 to 191
+    0b11000101, 0b10011100, 0b10101010, 0b10101111, 0b00010000, 0b10101110, 0b11101111, 0b00010000,   // 192 to 199
+    0b00101000, 0b01111001, 0b00101010, 0b11111011, 0b01110010, 0b01000110, 0b10011001, 0b10011001,   // 200 to 207
+    0b10101010, 0b11111011, 0b01010100, 0b01011010, 0b11010110, 0b11011010, 0b10100011, 0b11011011,   // 208 to 215
+    0b11110011, 0b01001110, 0b10101101, 0b01011101, 0b01011010, 0b11101010, 0b11111011, 0b01010100,   // 216 to 223
+    0b01111011, 0b11100011, 0b11101001, 0b11111110, 0b11111110, 0b00101000, 0b01011101, 0b01000001,   // 224 to 231
+    0b11011110, 0b01011101, 0b00001110, 0b10001000, 0b01011111, 0b01010100, 0b01001101, 0b01010101,   // 232 to 239
+    0b11001000, 0b11010101, 0b11000000, 0b10101000, 0b01010110, 0b01011000, 0b10000010, 0b01001000,   // 240 to 247
+    0b00110110, 0b01001001, 0b11000000, 0b10101001, 0b10100000, 0b10101000, 0b00111000, 0b11001000,   // 248 to 255
+    0b10101101, 0b11011101, 0b10101001, 0b11001000, 0b11101010, 0b01111010, 0b10111010, 0b01110001,   // 256 to 263
+    0b00011100, 0b10001011, 0b00011110, 0b11010111, 0b01011010, 0b10001000, 0b01011010, 0b11100001,   // 264 to 271
+    0b00101000, 0b11001001, 0b10110110, 0b11010110, 0b10100010, 0b11010110, 0b01011001, 0b00101110,   // 272 to 279
+    0b11110010, 0b10101010, 0b10001010, 0b10101011, 0b01011011, 0b10001010, 0b01001011, 0b00010010,   // 280 to 287
+    0b00111110, 0b01111001, 0b11100101, 0b00101000, 0b01010100, 0b10111011, 0b01011010, 0b01110011,   // 288 to 295
+    0b11011100, 0b01110111, 0b10010010, 0b01001110, 0b10100011, 0b10100101, 0b11100011, 0b11011011,   // 296 to 303
+    0b11100001, 0b11111000, 0b11110111, 0b01010101, 0b11100011, 0b10100010, 0b11011010, 0b11010110,   // 304 to 311
+    0b11011010, 0b01000001, 0b11111000, 0b11101110, 0b01010101, 0b00001010, 0b11000000, 0b01110110,   // 312 to 319
+    0b11000110, 0b10110111, 0b11011010, 0b10110110, 0b11110100, 0b10110110, 0b11111010, 0b10110111,   // 320 to 327
+    0b10100101, 0b10101011, 0b11101001, 0b11110011, 0b11001111, 0b10001001, 0b00010010, 0b01110010,   // 328 to 335
+    0b00110100, 0b00101110, 0b11010110, 0b01111110, 0b00110100, 0b01110111, 0b10010110, 0b01110001,   // 336 to 343
+    0b11100000, 0b10110110, 0b10110101, 0b01011010, 0b10110111, 0b11110000, 0b10110110, 0b11101000,   // 344 to 351
+    0b01111101, 0b10010010, 0b11001110, 0b01000001, 0b01000110, 0b11000100, 0b01110010, 0b11010110,   // 352 to 359
+    0b10000001, 0b00010001, 0b00000011, 0b10110111, 0b01011010, 0b10011110, 0b01111001, 0b11001100,   // 360 to 367
+    0b11100000, 0b10011010, 0b11101000, 0b01010111, 0b01011100, 0b10010001, 0b01010101, 0b01011010,   // 368 to 375
+    0b11000000, 0b10100001, 0b00100100, 0b11110100, 0b00101011, 0b10100101, 0b11100011, 0b01011011,   // 376 to 383
+    0b01010111, 0b00011110, 0b11100010, 0b11011010, 0b11000000, 0b10101000, 0b11111110, 0b01000011,   // 384 to 391
+    0b10000101, 0b01000011, 0b10100101, 0b11001101, 0b00000100, 0b10011010, 0b01101010, 0b00100110,   // 392 to 399
+    0b10111010, 0b11010000, 0b01100010, 0b10010101, 0b10010000, 0b10011001, 0b10010010, 0b11101010,   // 400 to 407
+    0b10001011, 0b10100101, 0b11110110, 0b11011110, 0b01001111, 0b00100111, 0b10010110, 0b10101010,   // 408 to 415
+    0b01100010, 0b10101001, 0b11111000, 0b11010110, 0b11010100, 0b01111011, 0b10100111, 0b01110010,   // 416 to 423
+    0b01000101, 0b01101011, 0b10100100, 0b01111000, 0b11100100, 0b01010110, 0b01001000, 0b10111111,   // 424 to 431
+    0b11011010, 0b01101110, 0b11011010, 0b10110101, 0b00101001, 0b11111000, 0b11110011, 0b00011100,   // 432 to 439
+    0b10110111, 0b10010010, 0b11000100, 0b10110110, 0b11111110, 0b10110111, 0b11011110, 0b10010011,   // 440 to 447
+    0b01011100, 0b01110011, 0b01010100, 0b01011111, 0b11110100, 0b01110110, 0b11111010, 0b10111110,   // 448 to 455
+    0b11010000, 0b10110101, 0b01000011, 0b10010101, 0b11000000, 0b10111100, 0b10011010, 0b11011100,   // 456 to 463
+    0b10101101, 0b11011010, 0b10001111, 0b11000110, 0b10101111, 0b11000110, 0b10010011, 0b01010011,   // 464 to 471
+    0b01001110, 0b01111010, 0b00111111, 0b11111000, 0b01000101, 0b11000000, 0b01100110, 0b10111011,   // 472 to 479
+    0b10101110, 0b10111011, 0b10110110, 0b11011010, 0b10110110, 0b10001010, 0b00101010, 0b00101011,   // 480 to 487
+    0b11011011, 0b11100001, 0b01011111, 0b01010101, 0b01110110, 0b11011101, 0b11000000, 0b00110000,   // 488 to 495
+    0b10101000, 0b01110101, 0b11100001, 0b00100101, 0b00101000, 0b01011010, 0b11101001, 0b00101110,   // 496 to 503
+    0b10001010, 0b01001010, 0b00110001, 0b10101011, 0b01010100, 0b01010100, 0b10101001, 0b01011111,   // 504 to 511
+    0b01010101, 0b11111000, 0b11000101, 0b00000100, 0b01000010, 0b10000100, 0b10101011, 0b10101011,   // 512 to 519
+    0b01011011, 0b01010101, 0b11001100, 0b11001001, 0b00110110, 0b01001000, 0b10001011, 0b11011011,   // 520 to 527
+    0b11100011, 0b00011110, 0b11010001, 0b11011110,   // 528 to 531
 };
 
-const GFXglyph F3x5Glyphs[] PROGMEM = {
-    { 198, 2, 0, 3, 0, -5 },   // ' '
-    { 187, 1, 5, 2, 0, -5 },   // '!'
-    { 183, 3, 2, 4, 0, -5 },   // '"'
-    { 478, 3, 5, 4, 0, -5 },   // '#'
-    { 194, 3, 7, 4, 0, -6 },   // '$'
-    { 480, 3, 5, 4, 0, -5 },   // '%'
-    {  29, 3, 5, 4, 0, -5 },   // '&'
-    { 198, 1, 2, 2, 0, -5 },   // "'"
-    { 193, 2, 5, 3, 0, -5 },   // '('
-    { 196, 2, 5, 3, 0, -5 },   // ')'
-    { 197, 3, 3, 4, 0, -4 },   // '*'
-    { 192, 3, 3, 4, 0, -4 },   // '+'
-    { 198, 1, 2, 2, 0, -1 },   // ','
-    { 198, 2, 1, 3, 0, -3 },   // '-'
-    { 198, 1, 1, 2, 0, -1 },   // '.'
-    { 160, 3, 5, 4, 0, -5 },   // '/'
-    { 483, 3, 5, 4, 0, -5 },   // '0'
-    { 127, 3, 5, 4, 0, -5 },   // '1'
-    {  68, 3, 5, 4, 0, -5 },   // '2'
-    { 485, 3, 5, 4, 0, -5 },   // '3'
-    { 128, 3, 5, 4, 0, -5 },   // '4'
-    { 487, 3, 5, 4, 0, -5 },   // '5'
-    { 489, 3, 5, 4, 0, -5 },   // '6'
-    { 153, 3, 5, 4, 0, -5 },   // '7'
-    { 102, 3, 5, 4, 0, -5 },   // '8'
-    { 173, 3, 5, 4, 0, -5 },   // '9'
-    { 197, 1, 3, 2, 0, -4 },   // ':'
-    { 183, 1, 4, 2, 0, -3 },   // ';'
-    {  61, 2, 3, 3, 0, -4 },   // '<'
-    { 256, 2, 3, 3, 0, -4 },   // '='
-    {  98, 2, 3, 3, 0, -4 },   // '>'
-    { 491, 3, 5, 4, 0, -5 },   // '?'
-    { 181, 3, 5, 4, 0, -5 },   // '@'
-    {  92, 3, 5, 4, 0, -5 },   // 'A'
-    { 191, 3, 5, 4, 0, -5 },   // 'B'
-    { 165, 3, 5, 4, 0, -5 },   // 'C'
-    { 493, 3, 5, 4, 0, -5 },   // 'D'
-    { 129, 3, 5, 4, 0, -5 },   // 'E'
-    { 495, 3, 5, 4, 0, -5 },   // 'F'
-    { 190, 3, 5, 4, 0, -5 },   // 'G'
-    { 497, 3, 5, 4, 0, -5 },   // 'H'
-    { 113, 3, 5, 4, 0, -5 },   // 'I'
-    {  61, 3, 5, 4, 0, -5 },   // 'J'
-    { 147, 3, 5, 4, 0, -5 },   // 'K'
-    {  95, 3, 5, 4, 0, -5 },   // 'L'
-    { 253, 3, 5, 4, 0, -5 },   // 'M'
-    {  62, 3, 5, 4, 0, -5 },   // 'N'
-    { 188, 3, 5, 4, 0, -5 },   // 'O'
-    { 499, 3, 5, 4, 0, -5 },   // 'P'
-    { 188, 3, 6, 4, 0, -5 },   // 'Q'
-    {  51, 3, 5, 4, 0, -5 },   // 'R'
-    {  34, 3, 5, 4, 0, -5 },   // 'S'
-    { 159, 3, 5, 4, 0, -5 },   // 'T'
-    {  50, 3, 5, 4, 0, -5 },   // 'U'
-    { 501, 3, 5, 4, 0, -5 },   // 'V'
-    { 503, 3, 5, 4, 0, -5 },   // 'W'
-    { 505, 3, 5, 4, 0, -5 },   // 'X'
-    { 167, 3, 5, 4, 0, -5 },   // 'Y'
-    {   5, 3, 5, 4, 0, -5 },   // 'Z'
-    { 187, 2, 5, 3, 0, -5 },   // '['
-    { 507, 3, 5, 4, 0, -5 },   // '\\'
-    { 186, 2, 5, 3, 0, -5 },   // ']'
-    { 172, 3, 2, 4, 0, -5 },   // '^'
-    { 188, 3, 1, 4, 0, -1 },   // '_'
-    { 196, 2, 2, 3, 0, -5 },   // '`'
-    { 182, 3, 4, 4, 0, -4 },   // 'a'
-    { 509, 3, 5, 4, 0, -5 },   // 'b'
-    { 137, 3, 4, 4, 0, -4 },   // 'c'
-    {  31, 3, 5, 4, 0, -5 },   // 'd'
-    {  81, 3, 4, 4, 0, -4 },   // 'e'
-    { 511, 3, 5, 4, 0, -5 },   // 'f'
-    { 513, 3, 5, 4, 0, -4 },   // 'g'
-    { 515, 3, 5, 4, 0, -5 },   // 'h'
-    { 147, 1, 5, 2, 0, -5 },   // 'i'
-    { 143, 2, 6, 3, 0, -5 },   // 'j'
-    { 174, 3, 5, 4, 0, -5 },   // 'k'
-    { 180, 2, 5, 3, 0, -5 },   // 'l'
-    { 185, 3, 4, 4, 0, -4 },   // 'm'
-    {  62, 3, 4, 4, 0, -4 },   // 'n'
-    { 184, 3, 4, 4, 0, -4 },   // 'o'
-    { 499, 3, 5, 4, 0, -4 },   // 'p'
-    { 104, 3, 5, 4, 0, -4 },   // 'q'
-    { 165, 3, 4, 4, 0, -4 },   // 'r'
-    { 158, 3, 4, 4, 0, -4 },   // 's'
-    {  56, 3, 5, 4, 0, -5 },   // 't'
-    { 178, 3, 4, 4, 0, -4 },   // 'u'
-    { 179, 3, 4, 4, 0, -4 },   // 'v'
-    { 183, 3, 4, 4, 0, -4 },   // 'w'
-    { 169, 3, 4, 4, 0, -4 },   // 'x'
-    { 517, 3, 5, 4, 0, -4 },   // 'y'
-    { 175, 3, 4, 4, 0, -4 },   // 'z'
-    { 519, 3, 5, 4, 0, -5 },   // '{'
-    { 185, 1, 5, 2, 0, -5 },   // '|'
-    { 521, 3, 5, 4, 0, -5 },   // '}'
-    { 176, 2, 3, 3, 0, -4 },   // '~'
-    { 523, 3, 5, 4, 0, -5 },   // '\x7f'
-    { 198, 2, 0, 3, 0, -5 },   // '\xa0'
-    { 147, 1, 5, 2, 0, -5 },   // '¡'
-    { 103, 3, 5, 4, 0, -5 },   // '¢'
-    { 525, 3, 5, 4, 0, -5 },   // '£'
-    { 478, 3, 5, 4, 0, -5 },   // '¤'
-    { 420, 3, 5, 4, 0, -5 },   // '¥'
-    { 189, 1, 5, 2, 0, -5 },   // '¦'
-    { 171, 3, 7, 4, 0, -6 },   // '§'
-    { 197, 3, 1, 4, 0, -5 },   // '¨'
-    { 170, 3, 3, 4, 0, -4 },   // '©'
-    { 151, 2, 3, 3, 0, -5 },   // 'ª'
-    { 148, 4, 3, 5, 0, -4 },   // '«'
-    { 153, 3, 2, 4, 0, -3 },   // '¬'
-    { 198, 1, 1, 2, 0, -3 },   // '\xad'
-    { 140, 3, 4, 4, 0, -5 },   // '®'
-    { 188, 3, 1, 4, 0, -5 },   // '¯'
-    { 170, 3, 3, 4, 0, -5 },   // '°'
-    { 527, 3, 5, 4, 0, -5 },   // '±'
-    {  15, 2, 4, 3, 0, -6 },   // '²'
-    { 514, 2, 4, 3, 0, -6 },   // '³'
-    { 193, 2, 2, 3, 0, -5 },   // '´'
-    { 112, 3, 5, 4, 0, -4 },   // 'µ'
-    {  94, 3, 5, 4, 0, -5 },   // '¶'
-    { 198, 1, 1, 2, 0, -3 },   // '·'
-    {  98, 2, 3, 3, 0, -2 },   // '¸'
-    { 104, 2, 4, 3, 0, -6 },   // '¹'
-    { 170, 3, 4, 4, 0, -6 },   // 'º'
-    { 168, 4, 3, 5, 0, -4 },   // '»'
-    { 216, 4, 6, 5, 0, -6 },   // '¼'
-    { 203, 4, 7, 5, 0, -6 },   // '½'
-    { 198, 6, 6, 7, 0, -6 },   // '¾'
-    {  78, 3, 5, 4, 0, -5 },   // '¿'
-    { 163, 3, 6, 4, 0, -6 },   // 'À'
-    { 156, 3, 6, 4, 0, -6 },   // 'Á'
-    { 141, 3, 6, 4, 0, -6 },   // 'Â'
-    { 135, 3, 6, 4, 0, -6 },   // 'Ã'
-    { 131, 3, 6, 4, 0, -6 },   // 'Ä'
-    { 141, 3, 6, 4, 0, -6 },   // 'Å'
-    { 176, 4, 5, 5, 0, -5 },   // 'Æ'
-    { 165, 3, 6, 4, 0, -5 },   // 'Ç'
-    { 151, 3, 6, 4, 0, -6 },   // 'È'
-    { 138, 3, 6, 4, 0, -6 },   // 'É'
-    { 133, 3, 6, 4, 0, -6 },   // 'Ê'
-    { 123, 3, 6, 4, 0, -6 },   // 'Ë'
-    { 117, 3, 6, 4, 0, -6 },   // 'Ì'
-    {  73, 3, 6, 4, 0, -6 },   // 'Í'
-    {  66, 3, 6, 4, 0, -6 },   // 'Î'
-    {  27, 3, 6, 4, 0, -6 },   // 'Ï'
-    {  69, 3, 5, 4, 0, -5 },   // 'Ð'
-    { 125, 3, 6, 4, 0, -6 },   // 'Ñ'
-    {  14, 3, 6, 4, 0, -6 },   // 'Ò'
-    {   3, 3, 6, 4, 0, -6 },   // 'Ó'
-    { 285, 3, 6, 4, 0, -6 },   // 'Ô'
-    { 288, 3, 6, 4, 0, -6 },   // 'Õ'
-    { 291, 3, 6, 4, 0, -6 },   // 'Ö'
-    { 197, 3, 3, 4, 0, -4 },   // '×'
-    { 529, 3, 5, 4, 0, -5 },   // 'Ø'
-    { 294, 3, 6, 4, 0, -6 },   // 'Ù'
-    { 297, 3, 6, 4, 0, -6 },   // 'Ú'
-    { 300, 3, 6, 4, 0, -6 },   // 'Û'
-    { 303, 3, 6, 4, 0, -6 },   // 'Ü'
-    { 161, 3, 6, 4, 0, -6 },   // 'Ý'
-    { 531, 3, 5, 4, 0, -5 },   // 'Þ'
-    {  55, 3, 5, 4, 0, -5 },   // 'ß'
-    { 306, 3, 6, 4, 0, -6 },   // 'à'
-    { 309, 3, 6, 4, 0, -6 },   // 'á'
-    { 312, 3, 6, 4, 0, -6 },   // 'â'
-    { 315, 3, 6, 4, 0, -6 },   // 'ã'
-    { 318, 3, 6, 4, 0, -6 },   // 'ä'
-    { 321, 3, 6, 4, 0, -6 },   // 'å'
-    { 468, 4, 4, 5, 0, -4 },   // 'æ'
-    { 533, 3, 5, 4, 0, -4 },   // 'ç'
-    { 324, 3, 6, 4, 0, -6 },   // 'è'
-    { 327, 3, 6, 4, 0, -6 },   // 'é'
-    { 330, 3, 6, 4, 0, -6 },   // 'ê'
-    { 333, 3, 6, 4, 0, -6 },   // 'ë'
-    { 109, 2, 6, 3, 0, -6 },   // 'ì'
-    { 144, 2, 6, 3, 0, -6 },   // 'í'
-    { 149, 3, 6, 4, 0, -6 },   // 'î'
-    {  20, 3, 5, 4, 0, -5 },   // 'ï'
-    { 252, 3, 5, 4, 0, -5 },   // 'ð'
-    { 125, 3, 6, 4, 0, -6 },   // 'ñ'
-    { 336, 3, 6, 4, 0, -6 },   // 'ò'
-    { 339, 3, 6, 4, 0, -6 },   // 'ó'
-    { 285, 3, 6, 4, 0, -6 },   // 'ô'
-    { 288, 3, 6, 4, 0, -6 },   // 'õ'
-    { 291, 3, 6, 4, 0, -6 },   // 'ö'
-    { 535, 3, 5, 4, 0, -5 },   // '÷'
-    { 529, 3, 5, 4, 0, -5 },   // 'ø'
-    { 294, 3, 6, 4, 0, -6 },   // 'ù'
-    { 297, 3, 6, 4, 0, -6 },   // 'ú'
-    { 300, 3, 6, 4, 0, -6 },   // 'û'
-    { 303, 3, 6, 4, 0, -6 },   // 'ü'
-    {  10, 3, 7, 4, 0, -6 },   // 'ý'
-    { 531, 3, 5, 4, 0, -5 },   // 'þ'
-    { 229, 3, 7, 4, 0, -6 },   // 'ÿ'
-    { 119, 3, 6, 4, 0, -6 },   // 'Ā'
-    { 315, 3, 6, 4, 0, -6 },   // 'ā'
-    { 100, 3, 6, 4, 0, -6 },   // 'Ă'
-    { 342, 3, 6, 4, 0, -6 },   // 'ă'
-    {  92, 3, 6, 4, 0, -5 },   // 'Ą'
-    { 537, 3, 5, 4, 0, -4 },   // 'ą'
-    { 345, 3, 6, 4, 0, -6 },   // 'Ć'
-    { 348, 3, 6, 4, 0, -6 },   // 'ć'
-    { 351, 3, 6, 4, 0, -6 },   // 'Ĉ'
-    { 354, 3, 6, 4, 0, -6 },   // 'ĉ'
-    { 357, 3, 6, 4, 0, -6 },   // 'Ċ'
-    { 357, 3, 6, 4, 0, -6 },   // 'ċ'
-    { 360, 3, 6, 4, 0, -6 },   // 'Č'
-    { 363, 3, 6, 4, 0, -6 },   // 'č'
-    { 145, 3, 6, 4, 0, -6 },   // 'Ď'
-    { 255, 4, 5, 5, 0, -5 },   // 'ď'
-    {  59, 4, 5, 5, 0, -5 },   // 'Đ'
-    {  57, 4, 5, 5, 0, -5 },   // 'đ'
-    { 366, 3, 6, 4, 0, -6 },   // 'Ē'
-    { 369, 3, 6, 4, 0, -6 },   // 'ē'
-    { 372, 3, 6, 4, 0, -6 },   // 'Ĕ'
-    { 375, 3, 6, 4, 0, -6 },   // 'ĕ'
-    { 378, 3, 6, 4, 0, -6 },   // 'Ė'
-    { 381, 3, 6, 4, 0, -6 },   // 'ė'
-    { 129, 3, 6, 4, 0, -5 },   // 'Ę'
-    { 539, 3, 5, 4, 0, -4 },   // 'ę'
-    { 372, 3, 6, 4, 0, -6 },   // 'Ě'
-    { 375, 3, 6, 4, 0, -6 },   // 'ě'
-    { 384, 3, 6, 4, 0, -6 },   // 'Ĝ'
-    { 232, 3, 7, 4, 0, -6 },   // 'ĝ'
-    { 387, 3, 6, 4, 0, -6 },   // 'Ğ'
-    { 235, 3, 7, 4, 0, -6 },   // 'ğ'
-    { 390, 3, 6, 4, 0, -6 },   // 'Ġ'
-    { 238, 3, 7, 4, 0, -6 },   // 'ġ'
-    { 121, 3, 6, 4, 0, -5 },   // 'Ģ'
-    { 241, 3, 7, 4, 0, -6 },   // 'ģ'
-    {  90, 3, 6, 4, 0, -6 },   // 'Ĥ'
-    {  88, 3, 6, 4, 0, -6 },   // 'ĥ'
-    { 478, 3, 5, 4, 0, -5 },   // 'Ħ'
-    { 541, 3, 5, 4, 0, -5 },   // 'ħ'
-    { 393, 3, 6, 4, 0, -6 },   // 'Ĩ'
-    {  75, 3, 5, 4, 0, -5 },   // 'ĩ'
-    { 393, 3, 6, 4, 0, -6 },   // 'Ī'
-    { 396, 3, 6, 4, 0, -6 },   // 'ī'
-    { 399, 3, 6, 4, 0, -6 },   // 'Ĭ'
-    { 115, 3, 6, 4, 0, -6 },   // 'ĭ'
-    { 113, 3, 6, 4, 0, -5 },   // 'Į'
-    { 478, 1, 6, 2, 0, -5 },   // 'į'
-    { 402, 3, 6, 4, 0, -6 },   // 'İ'
-    { 188, 1, 4, 2, 0, -4 },   // 'ı'
-    {  98, 4, 5, 5, 0, -5 },   // 'Ĳ'
-    {  42, 4, 6, 5, 0, -5 },   // 'ĳ'
-    { 110, 3, 6, 4, 0, -6 },   // 'Ĵ'
-    {  25, 3, 7, 4, 0, -6 },   // 'ĵ'
-    { 107, 3, 6, 4, 0, -5 },   // 'Ķ'
-    { 105, 3, 6, 4, 0, -5 },   // 'ķ'
-    {  97, 3, 3, 4, 0, -3 },   // 'ĸ'
-    { 405, 3, 6, 4, 0, -6 },   // 'Ĺ'
-    {  41, 2, 6, 3, 0, -6 },   // 'ĺ'
-    {  95, 3, 6, 4, 0, -5 },   // 'Ļ'
-    {  40, 2, 6, 3, 0, -5 },   // 'ļ'
-    { 408, 3, 6, 4, 0, -6 },   // 'Ľ'
-    {  82, 3, 6, 4, 0, -6 },   // 'ľ'
-    { 543, 3, 5, 4, 0, -5 },   // 'Ŀ'
-    { 545, 3, 5, 4, 0, -5 },   // 'ŀ'
-    {  79, 4, 5, 5, 0, -5 },   // 'Ł'
-    {   6, 3, 5, 4, 0, -5 },   // 'ł'
-    {  86, 3, 6, 4, 0, -6 },   // 'Ń'
-    {  76, 3, 6, 4, 0, -6 },   // 'ń'
-    {  62, 3, 6, 4, 0, -5 },   // 'Ņ'
-    { 547, 3, 5, 4, 0, -4 },   // 'ņ'
-    {  64, 3, 6, 4, 0, -6 },   // 'Ň'
-    {  53, 3, 6, 4, 0, -6 },   // 'ň'
-    {  36, 4, 6, 5, 0, -6 },   // 'ŉ'
-    {  32, 3, 6, 4, 0, -5 },   // 'Ŋ'
-    { 547, 3, 5, 4, 0, -4 },   // 'ŋ'
-    { 288, 3, 6, 4, 0, -6 },   // 'Ō'
-    { 288, 3, 6, 4, 0, -6 },   // 'ō'
-    { 411, 3, 6, 4, 0, -6 },   // 'Ŏ'
-    { 414, 3, 6, 4, 0, -6 },   // 'ŏ'
-    { 291, 3, 6, 4, 0, -6 },   // 'Ő'
-    { 291, 3, 6, 4, 0, -6 },   // 'ő'
-    { 258, 4, 5, 5, 0, -5 },   // 'Œ'
-    { 470, 4, 4, 5, 0, -4 },   // 'œ'
-    {  23, 3, 6, 4, 0, -6 },   // 'Ŕ'
-    { 154, 3, 6, 4, 0, -6 },   // 'ŕ'
-    {  51, 3, 6, 4, 0, -5 },   // 'Ŗ'
-    { 549, 3, 5, 4, 0, -4 },   // 'ŗ'
-    { 417, 3, 6, 4, 0, -6 },   // 'Ř'
-    {  84, 3, 6, 4, 0, -6 },   // 'ř'
-    {  48, 3, 6, 4, 0, -6 },   // 'Ś'
-    {  48, 3, 6, 4, 0, -6 },   // 'ś'
-    {  38, 3, 6, 4, 0, -6 },   // 'Ŝ'
-    {  38, 3, 6, 4, 0, -6 },   // 'ŝ'
-    {  34, 3, 6, 4, 0, -5 },   // 'Ş'
-    { 551, 3, 5, 4, 0, -4 },   // 'ş'
-    {  18, 3, 6, 4, 0, -6 },   // 'Š'
-    {  18, 3, 6, 4, 0, -6 },   // 'š'
-    {  16, 3, 6, 4, 0, -5 },   // 'Ţ'
-    {  12, 3, 6, 4, 0, -5 },   // 'ţ'
-    { 420, 3, 6, 4, 0, -6 },   // 'Ť'
-    { 219, 4, 6, 5, 0, -6 },   // 'ť'
-    { 554, 3, 5, 4, 0, -5 },   // 'Ŧ'
-    { 631, 2, 5, 3, 0, -5 },   // 'ŧ'
-    { 423, 3, 6, 4, 0, -6 },   // 'Ũ'
-    { 423, 3, 6, 4, 0, -6 },   // 'ũ'
-    { 423, 3, 6, 4, 0, -6 },   // 'Ū'
-    { 423, 3, 6, 4, 0, -6 },   // 'ū'
-    { 426, 3, 6, 4, 0, -6 },   // 'Ŭ'
-    { 426, 3, 6, 4, 0, -6 },   // 'ŭ'
-    { 429, 3, 6, 4, 0, -6 },   // 'Ů'
-    { 432, 3, 6, 4, 0, -6 },   // 'ů'
-    { 303, 3, 6, 4, 0, -6 },   // 'Ű'
-    { 303, 3, 6, 4, 0, -6 },   // 'ű'
-    { 435, 3, 6, 4, 0, -5 },   // 'Ų'
-    { 556, 3, 5, 4, 0, -4 },   // 'ų'
-    { 438, 3, 6, 4, 0, -6 },   // 'Ŵ'
-    { 438, 3, 6, 4, 0, -6 },   // 'ŵ'
-    { 441, 3, 6, 4, 0, -6 },   // 'Ŷ'
-    { 244, 3, 7, 4, 0, -6 },   // 'ŷ'
-    { 444, 3, 6, 4, 0, -6 },   // 'Ÿ'
-    { 447, 3, 6, 4, 0, -6 },   // 'Ź'
-    { 447, 3, 6, 4, 0, -6 },   // 'ź'
-    { 450, 3, 6, 4, 0, -6 },   // 'Ż'
-    { 450, 3, 6, 4, 0, -6 },   // 'ż'
-    { 453, 3, 6, 4, 0, -6 },   // 'Ž'
-    { 453, 3, 6, 4, 0, -6 },   // 'ž'
-    { 558, 3, 5, 4, 0, -5 },   // 'ſ'
-    {  92, 3, 5, 4, 0, -5 },   // 'А'
-    { 560, 3, 5, 4, 0, -5 },   // 'Б'
-    { 191, 3, 5, 4, 0, -5 },   // 'В'
-    { 562, 3, 5, 4, 0, -5 },   // 'Г'
-    { 456, 3, 6, 4, 0, -5 },   // 'Д'
-    { 129, 3, 5, 4, 0, -5 },   // 'Е'
-    { 208, 5, 5, 6, 0, -5 },   // 'Ж'
-    { 485, 3, 5, 4, 0, -5 },   // 'З'
-    { 564, 3, 5, 4, 0, -5 },   // 'И'
-    { 131, 3, 6, 4, 0, -6 },   // 'Й'
-    { 147, 3, 5, 4, 0, -5 },   // 'К'
-    { 566, 3, 5, 4, 0, -5 },   // 'Л'
-    { 253, 3, 5, 4, 0, -5 },   // 'М'
-    { 497, 3, 5, 4, 0, -5 },   // 'Н'
-    { 188, 3, 5, 4, 0, -5 },   // 'О'
-    { 568, 3, 5, 4, 0, -5 },   // 'П'
-    { 499, 3, 5, 4, 0, -5 },   // 'Р'
-    { 165, 3, 5, 4, 0, -5 },   // 'С'
-    { 159, 3, 5, 4, 0, -5 },   // 'Т'
-    {  70, 3, 5, 4, 0, -5 },   // 'У'
-    { 570, 3, 5, 4, 0, -5 },   // 'Ф'
-    { 505, 3, 5, 4, 0, -5 },   // 'Х'
-    { 223, 4, 6, 5, 0, -5 },   // 'Ц'
-    { 572, 3, 5, 4, 0, -5 },   // 'Ч'
-    { 574, 3, 5, 4, 0, -5 },   // 'Ш'
-    { 226, 4, 6, 5, 0, -5 },   // 'Щ'
-    { 576, 3, 5, 4, 0, -5 },   // 'Ъ'
-    { 578, 3, 5, 4, 0, -5 },   // 'Ы'
-    { 581, 3, 5, 4, 0, -5 },   // 'Ь'
-    { 583, 3, 5, 4, 0, -5 },   // 'Э'
-    { 261, 4, 5, 5, 0, -5 },   // 'Ю'
-    { 585, 3, 5, 4, 0, -5 },   // 'Я'
-    { 182, 3, 4, 4, 0, -4 },   // 'а'
-    { 587, 3, 5, 4, 0, -5 },   // 'б'
-    { 579, 3, 4, 4, 0, -4 },   // 'в'
-    { 283, 3, 4, 4, 0, -4 },   // 'г'
-    { 589, 3, 5, 4, 0, -4 },   // 'д'
-    {  81, 3, 4, 4, 0, -4 },   // 'е'
-    { 264, 5, 4, 6, 0, -4 },   // 'ж'
-    { 615, 3, 4, 4, 0, -4 },   // 'з'
-    { 564, 3, 4, 4, 0, -4 },   // 'и'
-    { 459, 3, 6, 4, 0, -6 },   // 'й'
-    { 617, 3, 4, 4, 0, -4 },   // 'к'
-    { 566, 3, 4, 4, 0, -4 },   // 'л'
-    { 185, 3, 4, 4, 0, -4 },   // 'м'
-    { 619, 3, 4, 4, 0, -4 },   // 'н'
-    { 184, 3, 4, 4, 0, -4 },   // 'о'
-    { 188, 3, 4, 4, 0, -4 },   // 'п'
-    { 499, 3, 4, 4, 0, -4 },   // 'р'
-    { 137, 3, 4, 4, 0, -4 },   // 'с'
-    { 159, 3, 4, 4, 0, -4 },   // 'т'
-    { 621, 3, 4, 4, 0, -4 },   // 'у'
-    { 623, 3, 4, 4, 0, -4 },   // 'ф'
-    { 169, 3, 4, 4, 0, -4 },   // 'х'
-    { 267, 4, 5, 5, 0, -4 },   // 'ц'
-    { 625, 3, 4, 4, 0, -4 },   // 'ч'
-    { 183, 3, 4, 4, 0, -4 },   // 'ш'
-    { 270, 4, 5, 5, 0, -4 },   // 'щ'
-    { 627, 3, 4, 4, 0, -4 },   // 'ъ'
-    { 478, 3, 4, 4, 0, -4 },   // 'ы'
-    { 531, 3, 4, 4, 0, -4 },   // 'ь'
-    { 615, 3, 4, 4, 0, -4 },   // 'э'
-    { 472, 4, 4, 5, 0, -4 },   // 'ю'
-    { 585, 3, 4, 4, 0, -4 },   // 'я'
-    { 591, 3, 5, 4, 0, -5 },   // 'ѐ'
-    { 593, 3, 5, 4, 0, -5 },   // 'ё'
-    { 595, 3, 5, 4, 0, -5 },   // 'ђ'
-    {  71, 3, 6, 4, 0, -6 },   // 'ѓ'
-    { 629, 3, 4, 4, 0, -4 },   // 'є'
-    { 158, 3, 4, 4, 0, -4 },   // 'ѕ'
-    { 147, 1, 5, 2, 0, -5 },   // 'і'
-    { 597, 3, 5, 4, 0, -5 },   // 'ї'
-    { 633, 2, 5, 3, 0, -5 },   // 'ј'
-    { 474, 4, 4, 5, 0, -4 },   // 'љ'
-    { 476, 4, 4, 5, 0, -4 },   // 'њ'
-    { 541, 3, 5, 4, 0, -5 },   // 'ћ'
-    { 462, 3, 6, 4, 0, -6 },   // 'ќ'
-    { 465, 3, 6, 4, 0, -6 },   // 'ѝ'
-    { 247, 3, 7, 4, 0, -6 },   // 'ў'
-    { 501, 3, 5, 4, 0, -4 },   // 'џ'
-    { 198, 2, 1, 3, 0, -3 },   // '‐'
-    { 198, 2, 1, 3, 0, -3 },   // '‑'
-    { 188, 3, 1, 4, 0, -3 },   // '‒'
-    { 188, 3, 1, 4, 0, -3 },   // '–'
-    { 188, 4, 1, 5, 0, -3 },   // '—'
-    { 188, 3, 1, 4, 0, -3 },   // '―'
-    { 599, 3, 5, 4, 0, -5 },   // '‖'
-    {  49, 3, 3, 4, 0, -3 },   // '‗'
-    { 187, 2, 2, 3, 0, -5 },   // '‘'
-    { 190, 2, 2, 3, 0, -5 },   // '’'
-    { 190, 2, 2, 3, 0, -2 },   // '‚'
-    { 187, 2, 2, 3, 0, -5 },   // '‛'
-    { 183, 3, 2, 4, 0, -5 },   // '“'
-    { 183, 3, 2, 4, 0, -5 },   // '”'
-    { 183, 3, 2, 4, 0, -2 },   // '„'
-    { 183, 3, 2, 4, 0, -5 },   // '‟'
-    { 601, 3, 5, 4, 0, -5 },   // '†'
-    { 603, 3, 5, 4, 0, -5 },   // '‡'
-    { 198, 1, 1, 2, 0, -3 },   // '•'
-    { 147, 2, 3, 3, 0, -4 },   // '‣'
-    { 198, 1, 1, 2, 0, -1 },   // '․'
-    { 197, 3, 1, 4, 0, -1 },   // '‥'
-    { 197, 5, 1, 6, 0, -1 },   // '…'
-    { 198, 1, 1, 2, 0, -3 },   // '‧'
-    { 198, 1, 0, 2, 0, -5 },   // '\u2028'
-    { 198, 1, 0, 2, 0, -5 },   // '\u2029'
-    { 198, 1, 0, 2, 0, -5 },   // '\u202a'
-    { 198, 1, 0, 2, 0, -5 },   // '\u202b'
-    { 198, 1, 0, 2, 0, -5 },   // '\u202c'
-    { 198, 1, 0, 2, 0, -5 },   // '\u202d'
-    { 198, 1, 0, 2, 0, -5 },   // '\u202e'
-    { 198, 1, 0, 2, 0, -5 },   // '\u202f'
-    { 273, 4, 5, 5, 0, -5 },   // '‰'
-    { 212, 5, 5, 6, 0, -5 },   // '‱'
-    { 198, 1, 2, 2, 0, -4 },   // '′'
-    { 183, 3, 2, 4, 0, -4 },   // '″'
-    { 256, 5, 2, 6, 0, -5 },   // '‴'
-    { 198, 1, 2, 2, 0, -4 },   // '‵'
-    { 183, 3, 2, 4, 0, -4 },   // '‶'
-    { 256, 5, 2, 6, 0, -5 },   // '‷'
-    { 172, 3, 2, 4, 0, -2 },   // '‸'
-    {  61, 2, 3, 3, 0, -4 },   // '‹'
-    {  98, 2, 3, 3, 0, -4 },   // '›'
-    { 197, 3, 3, 4, 0, -4 },   // '※'
-    { 605, 3, 5, 4, 0, -5 },   // '‼'
-    { 607, 3, 5, 4, 0, -5 },   // '‽'
-    { 188, 3, 1, 4, 0, -5 },   // '‾'
-    { 197, 3, 2, 4, 0, -2 },   // '‿'
-    { 172, 3, 2, 4, 0, -5 },   // '⁀'
-    { 156, 3, 3, 4, 0, -3 },   // '⁁'
-    { 221, 3, 3, 4, 0, -4 },   // '⁂'
-    { 198, 1, 1, 2, 0, -3 },   // '⁃'
-    {  47, 3, 3, 4, 0, -4 },   // '⁄'
-    { 227, 2, 5, 3, 0, -5 },   // '⁅'
-    { 635, 2, 5, 3, 0, -5 },   // '⁆'
-    {  44, 5, 5, 6, 0, -5 },   // '⁇'
-    { 276, 4, 5, 5, 0, -5 },   // '⁈'
-    { 279, 4, 5, 5, 0, -5 },   // '⁉'
-    { 552, 3, 3, 4, 0, -3 },   // '⁊'
-    { 609, 3, 5, 4, 0, -5 },   // '⁋'
-    {  94, 3, 3, 4, 0, -4 },   // '⁌'
-    {  30, 3, 3, 4, 0, -4 },   // '⁍'
-    { 197, 3, 3, 4, 0, -3 },   // '⁎'
-    { 183, 1, 4, 2, 0, -4 },   // '⁏'
-    { 441, 3, 5, 4, 0, -5 },   // '⁐'
-    { 250, 3, 7, 4, 0, -6 },   // '⁑'
-    { 480, 3, 5, 4, 0, -5 },   // '⁒'
-    { 148, 4, 2, 5, 0, -3 },   // '⁓'
-    { 172, 3, 2, 4, 0, -2 },   // '⁔'
-    { 197, 3, 3, 4, 0, -4 },   // '⁕'
-    { 206, 3, 3, 4, 0, -4 },   // '⁖'
-    { 613, 7, 2, 8, 0, -5 },   // '⁗'
-    { 170, 3, 3, 4, 0, -4 },   // '⁘'
-    { 197, 3, 3, 4, 0, -4 },   // '⁙'
-    { 197, 1, 3, 2, 0, -4 },   // '⁚'
-    { 481, 3, 5, 4, 0, -5 },   // '⁛'
-    { 611, 3, 5, 4, 0, -5 },   // '⁜'
-    { 197, 1, 5, 2, 0, -5 },   // '⁝'
-    { 197, 1, 5, 2, 0, -5 },   // '⁞'
-    { 198, 2, 0, 3, 0, -5 },   // '\u205f'
-    {  21, 4, 5, 5, 0, -5 },   // '←'
-    {   7, 5, 5, 6, 0, -5 },   // '↑'
-    { 282, 4, 5, 5, 0, -5 },   // '→'
-    {   0, 5, 5, 6, 0, -5 },   // '↓'
-    {  92, 3, 5, 4, 0, -5 },   // '🇦'
-    { 191, 3, 5, 4, 0, -5 },   // '🇧'
-    { 165, 3, 5, 4, 0, -5 },   // '🇨'
-    { 493, 3, 5, 4, 0, -5 },   // '🇩'
-    { 129, 3, 5, 4, 0, -5 },   // '🇪'
-    { 495, 3, 5, 4, 0, -5 },   // '🇫'
-    { 190, 3, 5, 4, 0, -5 },   // '🇬'
-    { 497, 3, 5, 4, 0, -5 },   // '🇭'
-    { 113, 3, 5, 4, 0, -5 },   // '🇮'
-    {  61, 3, 5, 4, 0, -5 },   // '🇯'
-    { 147, 3, 5, 4, 0, -5 },   // '🇰'
-    {  95, 3, 5, 4, 0, -5 },   // '🇱'
-    { 253, 3, 5, 4, 0, -5 },   // '🇲'
-    {  62, 3, 5, 4, 0, -5 },   // '🇳'
-    { 188, 3, 5, 4, 0, -5 },   // '🇴'
-    { 499, 3, 5, 4, 0, -5 },   // '🇵'
-    { 188, 3, 6, 4, 0, -5 },   // '🇶'
-    {  51, 3, 5, 4, 0, -5 },   // '🇷'
-    {  34, 3, 5, 4, 0, -5 },   // '🇸'
-    { 159, 3, 5, 4, 0, -5 },   // '🇹'
-    {  50, 3, 5, 4, 0, -5 },   // '🇺'
-    { 501, 3, 5, 4, 0, -5 },   // '🇻'
-    { 503, 3, 5, 4, 0, -5 },   // '🇼'
-    { 505, 3, 5, 4, 0, -5 },   // '🇽'
-    { 167, 3, 5, 4, 0, -5 },   // '🇾'
-    {   5, 3, 5, 4, 0, -5 },   // '🇿'
+inline constexpr GFXglyph F3x5Glyphs[] PROGMEM = {
+    {   0, 2, 0, 3, 0, -5 },   // ' '
+    { 221, 1, 5, 2, 0, -5 },   // '!'
+    { 363, 3, 2, 4, 0, -5 },   // '"'
+    { 107, 3, 5, 4, 0, -5 },   // '#'
+    { 412, 3, 7, 4, 0, -6 },   // '$'
+    { 392, 3, 5, 4, 0, -5 },   // '%'
+    { 530, 3, 5, 4, 0, -5 },   // '&'
+    { 179, 1, 2, 2, 0, -5 },   // "'"
+    {  29, 2, 5, 3, 0, -5 },   // '('
+    { 403, 2, 5, 3, 0, -5 },   // ')'
+    { 208, 3, 3, 4, 0, -4 },   // '*'
+    { 219, 3, 3, 4, 0, -4 },   // '+'
+    { 179, 1, 2, 2, 0, -1 },   // ','
+    { 179, 2, 1, 3, 0, -3 },   // '-'
+    { 179, 1, 1, 2, 0, -1 },   // '.'
+    { 499, 3, 5, 4, 0, -5 },   // '/'
+    { 492, 3, 5, 4, 0, -5 },   // '0'
+    { 278, 3, 5, 4, 0, -5 },   // '1'
+    { 131, 3, 5, 4, 0, -5 },   // '2'
+    {   6, 3, 5, 4, 0, -5 },   // '3'
+    { 279, 3, 5, 4, 0, -5 },   // '4'
+    { 438, 3, 5, 4, 0, -5 },   // '5'
+    { 295, 3, 5, 4, 0, -5 },   // '6'
+    { 290, 3, 5, 4, 0, -5 },   // '7'
+    { 120, 3, 5, 4, 0, -5 },   // '8'
+    { 297, 3, 5, 4, 0, -5 },   // '9'
+    { 218, 1, 3, 2, 0, -4 },   // ':'
+    { 363, 1, 4, 2, 0, -3 },   // ';'
+    {  44, 2, 3, 3, 0, -4 },   // '<'
+    { 367, 2, 3, 3, 0, -4 },   // '='
+    { 206, 2, 3, 3, 0, -4 },   // '>'
+    { 514, 3, 5, 4, 0, -5 },   // '?'
+    { 319, 3, 5, 4, 0, -5 },   // '@'
+    { 173, 3, 5, 4, 0, -5 },   // 'A'
+    {  18, 3, 5, 4, 0, -5 },   // 'B'
+    { 204, 3, 5, 4, 0, -5 },   // 'C'
+    { 139, 3, 5, 4, 0, -5 },   // 'D'
+    { 216, 3, 5, 4, 0, -5 },   // 'E'
+    {  10, 3, 5, 4, 0, -5 },   // 'F'
+    { 358, 3, 5, 4, 0, -5 },   // 'G'
+    { 321, 3, 5, 4, 0, -5 },   // 'H'
+    { 502, 3, 5, 4, 0, -5 },   // 'I'
+    {  32, 3, 5, 4, 0, -5 },   // 'J'
+    { 293, 3, 5, 4, 0, -5 },   // 'K'
+    { 298, 3, 5, 4, 0, -5 },   // 'L'
+    { 152, 3, 5, 4, 0, -5 },   // 'M'
+    { 212, 3, 5, 4, 0, -5 },   // 'N'
+    { 410, 3, 5, 4, 0, -5 },   // 'O'
+    {  22, 3, 5, 4, 0, -5 },   // 'P'
+    { 410, 3, 6, 4, 0, -5 },   // 'Q'
+    { 267, 3, 5, 4, 0, -5 },   // 'R'
+    { 263, 3, 5, 4, 0, -5 },   // 'S'
+    {   2, 3, 5, 4, 0, -5 },   // 'T'
+    { 274, 3, 5, 4, 0, -5 },   // 'U'
+    { 323, 3, 5, 4, 0, -5 },   // 'V'
+    { 325, 3, 5, 4, 0, -5 },   // 'W'
+    { 346, 3, 5, 4, 0, -5 },   // 'X'
+    { 327, 3, 5, 4, 0, -5 },   // 'Y'
+    {  26, 3, 5, 4, 0, -5 },   // 'Z'
+    { 221, 2, 5, 3, 0, -5 },   // '['
+    { 333, 3, 5, 4, 0, -5 },   // '\\'
+    { 241, 2, 5, 3, 0, -5 },   // ']'
+    {  46, 3, 2, 4, 0, -5 },   // '^'
+    { 221, 3, 1, 4, 0, -1 },   // '_'
+    {  43, 2, 2, 3, 0, -5 },   // '`'
+    {  69, 3, 4, 4, 0, -4 },   // 'a'
+    { 462, 3, 5, 4, 0, -5 },   // 'b'
+    { 335, 3, 4, 4, 0, -4 },   // 'c'
+    { 337, 3, 5, 4, 0, -5 },   // 'd'
+    { 339, 3, 4, 4, 0, -4 },   // 'e'
+    { 425, 3, 5, 4, 0, -5 },   // 'f'
+    { 341, 3, 5, 4, 0, -4 },   // 'g'
+    {  98, 3, 5, 4, 0, -5 },   // 'h'
+    { 107, 1, 5, 2, 0, -5 },   // 'i'
+    { 424, 2, 6, 3, 0, -5 },   // 'j'
+    { 406, 3, 5, 4, 0, -5 },   // 'k'
+    { 103, 2, 5, 3, 0, -5 },   // 'l'
+    { 152, 3, 4, 4, 0, -4 },   // 'm'
+    { 212, 3, 4, 4, 0, -4 },   // 'n'
+    {  75, 3, 4, 4, 0, -4 },   // 'o'
+    {  22, 3, 5, 4, 0, -4 },   // 'p'
+    {  97, 3, 5, 4, 0, -4 },   // 'q'
+    { 204, 3, 4, 4, 0, -4 },   // 'r'
+    { 343, 3, 4, 4, 0, -4 },   // 's'
+    {  14, 3, 5, 4, 0, -5 },   // 't'
+    { 345, 3, 4, 4, 0, -4 },   // 'u'
+    { 327, 3, 4, 4, 0, -4 },   // 'v'
+    { 348, 3, 4, 4, 0, -4 },   // 'w'
+    { 510, 3, 4, 4, 0, -4 },   // 'x'
+    { 133, 3, 5, 4, 0, -4 },   // 'y'
+    { 260, 3, 4, 4, 0, -4 },   // 'z'
+    { 398, 3, 5, 4, 0, -5 },   // '{'
+    {  60, 1, 5, 2, 0, -5 },   // '|'
+    { 255, 3, 5, 4, 0, -5 },   // '}'
+    { 105, 2, 3, 3, 0, -4 },   // '~'
+    { 227, 3, 5, 4, 0, -5 },   // U+007F
+    {   0, 2, 0, 3, 0, -5 },   // ' '
+    { 107, 1, 5, 2, 0, -5 },   // '¡'
+    { 113, 3, 5, 4, 0, -5 },   // '¢'
+    { 471, 3, 5, 4, 0, -5 },   // '£'
+    { 107, 3, 5, 4, 0, -5 },   // '¤'
+    { 135, 3, 5, 4, 0, -5 },   // '¥'
+    { 411, 1, 5, 2, 0, -5 },   // '¦'
+    {  61, 3, 7, 4, 0, -6 },   // '§'
+    { 218, 3, 1, 4, 0, -5 },   // '¨'
+    {  46, 3, 3, 4, 0, -4 },   // '©'
+    { 365, 2, 3, 3, 0, -5 },   // 'ª'
+    {  56, 4, 3, 5, 0, -4 },   // '«'
+    { 290, 3, 2, 4, 0, -3 },   // '¬'
+    { 179, 1, 1, 2, 0, -3 },   // U+00AD
+    { 306, 3, 4, 4, 0, -5 },   // '®'
+    { 221, 3, 1, 4, 0, -5 },   // '¯'
+    {  46, 3, 3, 4, 0, -5 },   // '°'
+    { 233, 3, 5, 4, 0, -5 },   // '±'
+    {  50, 2, 4, 3, 0, -6 },   // '²'
+    { 414, 2, 4, 3, 0, -6 },   // '³'
+    {  44, 2, 2, 3, 0, -5 },   // '´'
+    { 350, 3, 5, 4, 0, -4 },   // 'µ'
+    { 352, 3, 5, 4, 0, -5 },   // '¶'
+    { 179, 1, 1, 2, 0, -3 },   // '·'
+    { 206, 2, 3, 3, 0, -2 },   // '¸'
+    { 120, 2, 4, 3, 0, -6 },   // '¹'
+    { 491, 3, 4, 4, 0, -6 },   // 'º'
+    { 328, 4, 3, 5, 0, -4 },   // '»'
+    { 504, 4, 6, 5, 0, -6 },   // '¼'
+    { 285, 4, 7, 5, 0, -6 },   // '½'
+    { 179, 6, 6, 7, 0, -6 },   // '¾'
+    { 355, 3, 5, 4, 0, -5 },   // '¿'
+    {  59, 3, 6, 4, 0, -6 },   // 'À'
+    { 202, 3, 6, 4, 0, -6 },   // 'Á'
+    {  46, 3, 6, 4, 0, -6 },   // 'Â'
+    { 221, 3, 6, 4, 0, -6 },   // 'Ã'
+    { 208, 3, 6, 4, 0, -6 },   // 'Ä'
+    {  46, 3, 6, 4, 0, -6 },   // 'Å'
+    { 105, 4, 5, 5, 0, -5 },   // 'Æ'
+    { 204, 3, 6, 4, 0, -5 },   // 'Ç'
+    { 365, 3, 6, 4, 0, -6 },   // 'È'
+    { 288, 3, 6, 4, 0, -6 },   // 'É'
+    {  48, 3, 6, 4, 0, -6 },   // 'Ê'
+    { 177, 3, 6, 4, 0, -6 },   // 'Ë'
+    { 408, 3, 6, 4, 0, -6 },   // 'Ì'
+    { 380, 3, 6, 4, 0, -6 },   // 'Í'
+    {  62, 3, 6, 4, 0, -6 },   // 'Î'
+    { 300, 3, 6, 4, 0, -6 },   // 'Ï'
+    { 132, 3, 5, 4, 0, -5 },   // 'Ð'
+    { 382, 3, 6, 4, 0, -6 },   // 'Ñ'
+    { 526, 3, 6, 4, 0, -6 },   // 'Ò'
+    { 487, 3, 6, 4, 0, -6 },   // 'Ó'
+    { 223, 3, 6, 4, 0, -6 },   // 'Ô'
+    { 302, 3, 6, 4, 0, -6 },   // 'Õ'
+    { 214, 3, 6, 4, 0, -6 },   // 'Ö'
+    { 208, 3, 3, 4, 0, -4 },   // '×'
+    { 474, 3, 5, 4, 0, -5 },   // 'Ø'
+    { 269, 3, 6, 4, 0, -6 },   // 'Ù'
+    { 500, 3, 6, 4, 0, -6 },   // 'Ú'
+    { 210, 3, 6, 4, 0, -6 },   // 'Û'
+    { 309, 3, 6, 4, 0, -6 },   // 'Ü'
+    { 291, 3, 6, 4, 0, -6 },   // 'Ý'
+    { 369, 3, 5, 4, 0, -5 },   // 'Þ'
+    { 371, 3, 5, 4, 0, -5 },   // 'ß'
+    { 265, 3, 6, 4, 0, -6 },   // 'à'
+    {   0, 3, 6, 4, 0, -6 },   // 'á'
+    { 384, 3, 6, 4, 0, -6 },   // 'â'
+    { 528, 3, 6, 4, 0, -6 },   // 'ã'
+    { 129, 3, 6, 4, 0, -6 },   // 'ä'
+    { 491, 3, 6, 4, 0, -6 },   // 'å'
+    { 331, 4, 4, 5, 0, -4 },   // 'æ'
+    { 335, 3, 5, 4, 0, -4 },   // 'ç'
+    {   4, 3, 6, 4, 0, -6 },   // 'è'
+    { 436, 3, 6, 4, 0, -6 },   // 'é'
+    { 512, 3, 6, 4, 0, -6 },   // 'ê'
+    {  16, 3, 6, 4, 0, -6 },   // 'ë'
+    { 373, 2, 6, 3, 0, -6 },   // 'ì'
+    { 416, 2, 6, 3, 0, -6 },   // 'í'
+    { 175, 3, 6, 4, 0, -6 },   // 'î'
+    { 377, 3, 5, 4, 0, -5 },   // 'ï'
+    { 389, 3, 5, 4, 0, -5 },   // 'ð'
+    { 382, 3, 6, 4, 0, -6 },   // 'ñ'
+    { 137, 3, 6, 4, 0, -6 },   // 'ò'
+    {   8, 3, 6, 4, 0, -6 },   // 'ó'
+    { 223, 3, 6, 4, 0, -6 },   // 'ô'
+    { 302, 3, 6, 4, 0, -6 },   // 'õ'
+    { 214, 3, 6, 4, 0, -6 },   // 'ö'
+    { 391, 3, 5, 4, 0, -5 },   // '÷'
+    { 474, 3, 5, 4, 0, -5 },   // 'ø'
+    { 269, 3, 6, 4, 0, -6 },   // 'ù'
+    { 500, 3, 6, 4, 0, -6 },   // 'ú'
+    { 210, 3, 6, 4, 0, -6 },   // 'û'
+    { 309, 3, 6, 4, 0, -6 },   // 'ü'
+    {  12, 3, 7, 4, 0, -6 },   // 'ý'
+    { 369, 3, 5, 4, 0, -5 },   // 'þ'
+    { 276, 3, 7, 4, 0, -6 },   // 'ÿ'
+    { 489, 3, 6, 4, 0, -6 },   // 'Ā'
+    { 528, 3, 6, 4, 0, -6 },   // 'ā'
+    { 510, 3, 6, 4, 0, -6 },   // 'Ă'
+    { 150, 3, 6, 4, 0, -6 },   // 'ă'
+    { 173, 3, 6, 4, 0, -5 },   // 'Ą'
+    {  69, 3, 5, 4, 0, -4 },   // 'ą'
+    {  20, 3, 6, 4, 0, -6 },   // 'Ć'
+    {  24, 3, 6, 4, 0, -6 },   // 'ć'
+    { 239, 3, 6, 4, 0, -6 },   // 'Ĉ'
+    {  67, 3, 6, 4, 0, -6 },   // 'ĉ'
+    {  73, 3, 6, 4, 0, -6 },   // 'Ċ'
+    {  73, 3, 6, 4, 0, -6 },   // 'ċ'
+    { 258, 3, 6, 4, 0, -6 },   // 'Č'
+    { 253, 3, 6, 4, 0, -6 },   // 'č'
+    { 283, 3, 6, 4, 0, -6 },   // 'Ď'
+    { 521, 4, 5, 5, 0, -5 },   // 'ď'
+    {  30, 4, 5, 5, 0, -5 },   // 'Đ'
+    {  28, 4, 5, 5, 0, -5 },   // 'đ'
+    { 225, 3, 6, 4, 0, -6 },   // 'Ē'
+    { 304, 3, 6, 4, 0, -6 },   // 'ē'
+    { 329, 3, 6, 4, 0, -6 },   // 'Ĕ'
+    { 417, 3, 6, 4, 0, -6 },   // 'ĕ'
+    {  79, 3, 6, 4, 0, -6 },   // 'Ė'
+    { 313, 3, 6, 4, 0, -6 },   // 'ė'
+    { 216, 3, 6, 4, 0, -5 },   // 'Ę'
+    { 339, 3, 5, 4, 0, -4 },   // 'ę'
+    { 329, 3, 6, 4, 0, -6 },   // 'Ě'
+    { 417, 3, 6, 4, 0, -6 },   // 'ě'
+    {  85, 3, 6, 4, 0, -6 },   // 'Ĝ'
+    { 111, 3, 7, 4, 0, -6 },   // 'ĝ'
+    {  37, 3, 6, 4, 0, -6 },   // 'Ğ'
+    {  54, 3, 7, 4, 0, -6 },   // 'ğ'
+    { 190, 3, 6, 4, 0, -6 },   // 'Ġ'
+    { 231, 3, 7, 4, 0, -6 },   // 'ġ'
+    { 358, 3, 6, 4, 0, -5 },   // 'Ģ'
+    {  34, 3, 7, 4, 0, -6 },   // 'ģ'
+    { 171, 3, 6, 4, 0, -6 },   // 'Ĥ'
+    { 237, 3, 6, 4, 0, -6 },   // 'ĥ'
+    { 107, 3, 5, 4, 0, -5 },   // 'Ħ'
+    { 397, 3, 5, 4, 0, -5 },   // 'ħ'
+    { 123, 3, 6, 4, 0, -6 },   // 'Ĩ'
+    { 271, 3, 5, 4, 0, -5 },   // 'ĩ'
+    { 123, 3, 6, 4, 0, -6 },   // 'Ī'
+    { 271, 3, 6, 4, 0, -6 },   // 'ī'
+    { 496, 3, 6, 4, 0, -6 },   // 'Ĭ'
+    {  41, 3, 6, 4, 0, -6 },   // 'ĭ'
+    { 502, 3, 6, 4, 0, -5 },   // 'Į'
+    { 107, 1, 6, 2, 0, -5 },   // 'į'
+    { 393, 3, 6, 4, 0, -6 },   // 'İ'
+    { 410, 1, 4, 2, 0, -4 },   // 'ı'
+    { 206, 4, 5, 5, 0, -5 },   // 'Ĳ'
+    { 404, 4, 6, 5, 0, -5 },   // 'ĳ'
+    {  57, 3, 6, 4, 0, -6 },   // 'Ĵ'
+    { 175, 3, 7, 4, 0, -6 },   // 'ĵ'
+    { 363, 3, 6, 4, 0, -5 },   // 'Ķ'
+    { 406, 3, 6, 4, 0, -5 },   // 'ķ'
+    { 400, 3, 3, 4, 0, -3 },   // 'ĸ'
+    {  51, 3, 6, 4, 0, -6 },   // 'Ĺ'
+    { 402, 2, 6, 3, 0, -6 },   // 'ĺ'
+    { 298, 3, 6, 4, 0, -5 },   // 'Ļ'
+    { 415, 2, 6, 3, 0, -5 },   // 'ļ'
+    { 248, 3, 6, 4, 0, -6 },   // 'Ľ'
+    { 524, 3, 6, 4, 0, -6 },   // 'ľ'
+    { 353, 3, 5, 4, 0, -5 },   // 'Ŀ'
+    { 441, 3, 5, 4, 0, -5 },   // 'ŀ'
+    { 356, 4, 5, 5, 0, -5 },   // 'Ł'
+    {  27, 3, 5, 4, 0, -5 },   // 'ł'
+    {  65, 3, 6, 4, 0, -6 },   // 'Ń'
+    {  71, 3, 6, 4, 0, -6 },   // 'ń'
+    { 212, 3, 6, 4, 0, -5 },   // 'Ņ'
+    { 419, 3, 5, 4, 0, -4 },   // 'ņ'
+    { 519, 3, 6, 4, 0, -6 },   // 'Ň'
+    {  77, 3, 6, 4, 0, -6 },   // 'ň'
+    {  83, 4, 6, 5, 0, -6 },   // 'ŉ'
+    { 311, 3, 6, 4, 0, -5 },   // 'Ŋ'
+    { 419, 3, 5, 4, 0, -4 },   // 'ŋ'
+    { 302, 3, 6, 4, 0, -6 },   // 'Ō'
+    { 302, 3, 6, 4, 0, -6 },   // 'ō'
+    {  89, 3, 6, 4, 0, -6 },   // 'Ŏ'
+    {  92, 3, 6, 4, 0, -6 },   // 'ŏ'
+    { 214, 3, 6, 4, 0, -6 },   // 'Ő'
+    { 214, 3, 6, 4, 0, -6 },   // 'ő'
+    { 261, 4, 5, 5, 0, -5 },   // 'Œ'
+    { 421, 4, 4, 5, 0, -4 },   // 'œ'
+    {  95, 3, 6, 4, 0, -6 },   // 'Ŕ'
+    { 100, 3, 6, 4, 0, -6 },   // 'ŕ'
+    { 267, 3, 6, 4, 0, -5 },   // 'Ŗ'
+    { 423, 3, 5, 4, 0, -4 },   // 'ŗ'
+    { 109, 3, 6, 4, 0, -6 },   // 'Ř'
+    { 115, 3, 6, 4, 0, -6 },   // 'ř'
+    { 122, 3, 6, 4, 0, -6 },   // 'Ś'
+    { 122, 3, 6, 4, 0, -6 },   // 'ś'
+    { 307, 3, 6, 4, 0, -6 },   // 'Ŝ'
+    { 307, 3, 6, 4, 0, -6 },   // 'ŝ'
+    { 263, 3, 6, 4, 0, -5 },   // 'Ş'
+    { 427, 3, 5, 4, 0, -4 },   // 'ş'
+    { 127, 3, 6, 4, 0, -6 },   // 'Š'
+    { 127, 3, 6, 4, 0, -6 },   // 'š'
+    {   2, 3, 6, 4, 0, -5 },   // 'Ţ'
+    {  14, 3, 6, 4, 0, -5 },   // 'ţ'
+    { 135, 3, 6, 4, 0, -6 },   // 'Ť'
+    { 183, 4, 6, 5, 0, -6 },   // 'ť'
+    {  81, 3, 5, 4, 0, -5 },   // 'Ŧ'
+    { 315, 2, 5, 3, 0, -5 },   // 'ŧ'
+    { 386, 3, 6, 4, 0, -6 },   // 'Ũ'
+    { 386, 3, 6, 4, 0, -6 },   // 'ũ'
+    { 386, 3, 6, 4, 0, -6 },   // 'Ū'
+    { 386, 3, 6, 4, 0, -6 },   // 'ū'
+    { 141, 3, 6, 4, 0, -6 },   // 'Ŭ'
+    { 141, 3, 6, 4, 0, -6 },   // 'ŭ'
+    { 374, 3, 6, 4, 0, -6 },   // 'Ů'
+    { 316, 3, 6, 4, 0, -6 },   // 'ů'
+    { 309, 3, 6, 4, 0, -6 },   // 'Ű'
+    { 309, 3, 6, 4, 0, -6 },   // 'ű'
+    { 274, 3, 6, 4, 0, -5 },   // 'Ų'
+    { 345, 3, 5, 4, 0, -4 },   // 'ų'
+    { 450, 3, 6, 4, 0, -6 },   // 'Ŵ'
+    { 450, 3, 6, 4, 0, -6 },   // 'ŵ'
+    { 508, 3, 6, 4, 0, -6 },   // 'Ŷ'
+    { 144, 3, 7, 4, 0, -6 },   // 'ŷ'
+    { 148, 3, 6, 4, 0, -6 },   // 'Ÿ'
+    { 154, 3, 6, 4, 0, -6 },   // 'Ź'
+    { 154, 3, 6, 4, 0, -6 },   // 'ź'
+    { 458, 3, 6, 4, 0, -6 },   // 'Ż'
+    { 458, 3, 6, 4, 0, -6 },   // 'ż'
+    { 157, 3, 6, 4, 0, -6 },   // 'Ž'
+    { 157, 3, 6, 4, 0, -6 },   // 'ž'
+    { 429, 3, 5, 4, 0, -5 },   // 'ſ'
+    { 173, 3, 5, 4, 0, -5 },   // 'А'
+    {  87, 3, 5, 4, 0, -5 },   // 'Б'
+    {  18, 3, 5, 4, 0, -5 },   // 'В'
+    { 186, 3, 5, 4, 0, -5 },   // 'Г'
+    { 160, 3, 6, 4, 0, -5 },   // 'Д'
+    { 216, 3, 5, 4, 0, -5 },   // 'Е'
+    { 218, 5, 5, 6, 0, -5 },   // 'Ж'
+    {   6, 3, 5, 4, 0, -5 },   // 'З'
+    { 431, 3, 5, 4, 0, -5 },   // 'И'
+    { 208, 3, 6, 4, 0, -6 },   // 'Й'
+    { 293, 3, 5, 4, 0, -5 },   // 'К'
+    { 433, 3, 5, 4, 0, -5 },   // 'Л'
+    { 152, 3, 5, 4, 0, -5 },   // 'М'
+    { 321, 3, 5, 4, 0, -5 },   // 'Н'
+    { 410, 3, 5, 4, 0, -5 },   // 'О'
+    {  39, 3, 5, 4, 0, -5 },   // 'П'
+    {  22, 3, 5, 4, 0, -5 },   // 'Р'
+    { 204, 3, 5, 4, 0, -5 },   // 'С'
+    {   2, 3, 5, 4, 0, -5 },   // 'Т'
+    { 435, 3, 5, 4, 0, -5 },   // 'У'
+    { 451, 3, 5, 4, 0, -5 },   // 'Ф'
+    { 346, 3, 5, 4, 0, -5 },   // 'Х'
+    { 163, 4, 6, 5, 0, -5 },   // 'Ц'
+    { 440, 3, 5, 4, 0, -5 },   // 'Ч'
+    { 443, 3, 5, 4, 0, -5 },   // 'Ш'
+    { 166, 4, 6, 5, 0, -5 },   // 'Щ'
+    { 523, 3, 5, 4, 0, -5 },   // 'Ъ'
+    { 445, 3, 5, 4, 0, -5 },   // 'Ы'
+    { 447, 3, 5, 4, 0, -5 },   // 'Ь'
+    { 192, 3, 5, 4, 0, -5 },   // 'Э'
+    { 256, 4, 5, 5, 0, -5 },   // 'Ю'
+    {  63, 3, 5, 4, 0, -5 },   // 'Я'
+    {  69, 3, 4, 4, 0, -4 },   // 'а'
+    { 449, 3, 5, 4, 0, -5 },   // 'б'
+    { 125, 3, 4, 4, 0, -4 },   // 'в'
+    { 186, 3, 4, 4, 0, -4 },   // 'г'
+    { 453, 3, 5, 4, 0, -4 },   // 'д'
+    { 339, 3, 4, 4, 0, -4 },   // 'е'
+    { 169, 5, 4, 6, 0, -4 },   // 'ж'
+    { 367, 3, 4, 4, 0, -4 },   // 'з'
+    { 431, 3, 4, 4, 0, -4 },   // 'и'
+    { 188, 3, 6, 4, 0, -6 },   // 'й'
+    { 400, 3, 4, 4, 0, -4 },   // 'к'
+    { 433, 3, 4, 4, 0, -4 },   // 'л'
+    { 152, 3, 4, 4, 0, -4 },   // 'м'
+    { 455, 3, 4, 4, 0, -4 },   // 'н'
+    {  75, 3, 4, 4, 0, -4 },   // 'о'
+    { 410, 3, 4, 4, 0, -4 },   // 'п'
+    {  22, 3, 4, 4, 0, -4 },   // 'р'
+    { 335, 3, 4, 4, 0, -4 },   // 'с'
+    { 502, 3, 4, 4, 0, -4 },   // 'т'
+    { 457, 3, 4, 4, 0, -4 },   // 'у'
+    {  36, 3, 4, 4, 0, -4 },   // 'ф'
+    { 510, 3, 4, 4, 0, -4 },   // 'х'
+    { 194, 4, 5, 5, 0, -4 },   // 'ц'
+    { 461, 3, 4, 4, 0, -4 },   // 'ч'
+    { 348, 3, 4, 4, 0, -4 },   // 'ш'
+    { 197, 4, 5, 5, 0, -4 },   // 'щ'
+    { 273, 3, 4, 4, 0, -4 },   // 'ъ'
+    { 107, 3, 4, 4, 0, -4 },   // 'ы'
+    { 369, 3, 4, 4, 0, -4 },   // 'ь'
+    { 367, 3, 4, 4, 0, -4 },   // 'э'
+    { 464, 4, 4, 5, 0, -4 },   // 'ю'
+    {  63, 3, 4, 4, 0, -4 },   // 'я'
+    { 466, 3, 5, 4, 0, -5 },   // 'ѐ'
+    { 468, 3, 5, 4, 0, -5 },   // 'ё'
+    { 470, 3, 5, 4, 0, -5 },   // 'ђ'
+    { 200, 3, 6, 4, 0, -6 },   // 'ѓ'
+    { 473, 3, 4, 4, 0, -4 },   // 'є'
+    { 343, 3, 4, 4, 0, -4 },   // 'ѕ'
+    { 107, 1, 5, 2, 0, -5 },   // 'і'
+    { 498, 3, 5, 4, 0, -5 },   // 'ї'
+    { 476, 2, 5, 3, 0, -5 },   // 'ј'
+    { 478, 4, 4, 5, 0, -4 },   // 'љ'
+    { 480, 4, 4, 5, 0, -4 },   // 'њ'
+    { 397, 3, 5, 4, 0, -5 },   // 'ћ'
+    { 229, 3, 6, 4, 0, -6 },   // 'ќ'
+    { 235, 3, 6, 4, 0, -6 },   // 'ѝ'
+    { 243, 3, 7, 4, 0, -6 },   // 'ў'
+    { 323, 3, 5, 4, 0, -4 },   // 'џ'
+    { 179, 2, 1, 3, 0, -3 },   // '‐'
+    { 179, 2, 1, 3, 0, -3 },   // '‑'
+    { 221, 3, 1, 4, 0, -3 },   // '‒'
+    { 221, 3, 1, 4, 0, -3 },   // '–'
+    { 410, 4, 1, 5, 0, -3 },   // '—'
+    { 221, 3, 1, 4, 0, -3 },   // '―'
+    { 482, 3, 5, 4, 0, -5 },   // '‖'
+    { 302, 3, 3, 4, 0, -3 },   // '‗'
+    { 221, 2, 2, 3, 0, -5 },   // '‘'
+    { 105, 2, 2, 3, 0, -5 },   // '’'
+    { 105, 2, 2, 3, 0, -2 },   // '‚'
+    { 221, 2, 2, 3, 0, -5 },   // '‛'
+    { 363, 3, 2, 4, 0, -5 },   // '“'
+    { 363, 3, 2, 4, 0, -5 },   // '”'
+    { 363, 3, 2, 4, 0, -2 },   // '„'
+    { 363, 3, 2, 4, 0, -5 },   // '‟'
+    { 146, 3, 5, 4, 0, -5 },   // '†'
+    {  96, 3, 5, 4, 0, -5 },   // '‡'
+    { 179, 1, 1, 2, 0, -3 },   // '•'
+    { 293, 2, 3, 3, 0, -4 },   // '‣'
+    { 179, 1, 1, 2, 0, -1 },   // '․'
+    { 218, 3, 1, 4, 0, -1 },   // '‥'
+    { 218, 5, 1, 6, 0, -1 },   // '…'
+    { 179, 1, 1, 2, 0, -3 },   // '‧'
+    {   0, 1, 0, 2, 0, -5 },   // U+2028
+    {   0, 1, 0, 2, 0, -5 },   // U+2029
+    {   0, 1, 0, 2, 0, -5 },   // U+202A
+    {   0, 1, 0, 2, 0, -5 },   // U+202B
+    {   0, 1, 0, 2, 0, -5 },   // U+202C
+    {   0, 1, 0, 2, 0, -5 },   // U+202D
+    {   0, 1, 0, 2, 0, -5 },   // U+202E
+    {   0, 1, 0, 2, 0, -5 },   // ' '
+    { 246, 4, 5, 5, 0, -5 },   // '‰'
+    { 360, 5, 5, 6, 0, -5 },   // '‱'
+    { 179, 1, 2, 2, 0, -4 },   // '′'
+    { 363, 3, 2, 4, 0, -4 },   // '″'
+    { 522, 5, 2, 6, 0, -5 },   // '‴'
+    { 179, 1, 2, 2, 0, -4 },   // '‵'
+    { 363, 3, 2, 4, 0, -4 },   // '‶'
+    { 522, 5, 2, 6, 0, -5 },   // '‷'
+    {  46, 3, 2, 4, 0, -2 },   // '‸'
+    {  44, 2, 3, 3, 0, -4 },   // '‹'
+    { 206, 2, 3, 3, 0, -4 },   // '›'
+    { 208, 3, 3, 4, 0, -4 },   // '※'
+    { 484, 3, 5, 4, 0, -5 },   // '‼'
+    { 395, 3, 5, 4, 0, -5 },   // '‽'
+    { 221, 3, 1, 4, 0, -5 },   // '‾'
+    { 103, 3, 2, 4, 0, -2 },   // '‿'
+    {  46, 3, 2, 4, 0, -5 },   // '⁀'
+    { 118, 3, 3, 4, 0, -3 },   // '⁁'
+    { 185, 3, 3, 4, 0, -4 },   // '⁂'
+    { 179, 1, 1, 2, 0, -3 },   // '⁃'
+    { 486, 3, 3, 4, 0, -4 },   // '⁄'
+    { 167, 2, 5, 3, 0, -5 },   // '⁅'
+    { 493, 2, 5, 3, 0, -5 },   // '⁆'
+    {  43, 5, 5, 6, 0, -5 },   // '⁇'
+    { 403, 4, 5, 5, 0, -5 },   // '⁈'
+    { 251, 4, 5, 5, 0, -5 },   // '⁉'
+    {  53, 3, 3, 4, 0, -3 },   // '⁊'
+    { 161, 3, 5, 4, 0, -5 },   // '⁋'
+    { 352, 3, 3, 4, 0, -4 },   // '⁌'
+    { 161, 3, 3, 4, 0, -4 },   // '⁍'
+    { 208, 3, 3, 4, 0, -3 },   // '⁎'
+    { 363, 1, 4, 2, 0, -4 },   // '⁏'
+    { 508, 3, 5, 4, 0, -5 },   // '⁐'
+    { 281, 3, 7, 4, 0, -6 },   // '⁑'
+    { 392, 3, 5, 4, 0, -5 },   // '⁒'
+    { 220, 4, 2, 5, 0, -3 },   // '⁓'
+    {  46, 3, 2, 4, 0, -2 },   // '⁔'
+    { 208, 3, 3, 4, 0, -4 },   // '⁕'
+    { 495, 3, 3, 4, 0, -4 },   // '⁖'
+    { 507, 7, 2, 8, 0, -5 },   // '⁗'
+    {  46, 3, 3, 4, 0, -4 },   // '⁘'
+    { 208, 3, 3, 4, 0, -4 },   // '⁙'
+    { 218, 1, 3, 2, 0, -4 },   // '⁚'
+    { 516, 3, 5, 4, 0, -5 },   // '⁛'
+    { 518, 3, 5, 4, 0, -5 },   // '⁜'
+    { 218, 1, 5, 2, 0, -5 },   // '⁝'
+    { 218, 1, 5, 2, 0, -5 },   // '⁞'
+    {   0, 2, 0, 3, 0, -5 },   // ' '
+    { 378, 4, 5, 5, 0, -5 },   // '←'
+    { 102, 5, 5, 6, 0, -5 },   // '↑'
+    { 185, 4, 5, 5, 0, -5 },   // '→'
+    { 117, 5, 5, 6, 0, -5 },   // '↓'
+    { 173, 3, 5, 4, 0, -5 },   // '🇦'
+    {  18, 3, 5, 4, 0, -5 },   // '🇧'
+    { 204, 3, 5, 4, 0, -5 },   // '🇨'
+    { 139, 3, 5, 4, 0, -5 },   // '🇩'
+    { 216, 3, 5, 4, 0, -5 },   // '🇪'
+    {  10, 3, 5, 4, 0, -5 },   // '🇫'
+    { 358, 3, 5, 4, 0, -5 },   // '🇬'
+    { 321, 3, 5, 4, 0, -5 },   // '🇭'
+    { 502, 3, 5, 4, 0, -5 },   // '🇮'
+    {  32, 3, 5, 4, 0, -5 },   // '🇯'
+    { 293, 3, 5, 4, 0, -5 },   // '🇰'
+    { 298, 3, 5, 4, 0, -5 },   // '🇱'
+    { 152, 3, 5, 4, 0, -5 },   // '🇲'
+    { 212, 3, 5, 4, 0, -5 },   // '🇳'
+    { 410, 3, 5, 4, 0, -5 },   // '🇴'
+    {  22, 3, 5, 4, 0, -5 },   // '🇵'
+    { 410, 3, 6, 4, 0, -5 },   // '🇶'
+    { 267, 3, 5, 4, 0, -5 },   // '🇷'
+    { 263, 3, 5, 4, 0, -5 },   // '🇸'
+    {   2, 3, 5, 4, 0, -5 },   // '🇹'
+    { 274, 3, 5, 4, 0, -5 },   // '🇺'
+    { 323, 3, 5, 4, 0, -5 },   // '🇻'
+    { 325, 3, 5, 4, 0, -5 },   // '🇼'
+    { 346, 3, 5, 4, 0, -5 },   // '🇽'
+    { 327, 3, 5, 4, 0, -5 },   // '🇾'
+    {  26, 3, 5, 4, 0, -5 },   // '🇿'
 };
 
-const UTF8_32BitFont F3x5[] PROGMEM = {
+inline constexpr UTF8_32BitFont F3x5[] PROGMEM = {
     {
         (uint8_t  *) F3x5Bitmaps,
         (GFXglyph *) &F3x5Glyphs[0],
@@ -636,27 +628,28 @@ const UTF8_32BitFont F3x5[] PROGMEM = {
         0, 0, 6,
         127462, 127487
     },
+    EMOJI_SEGMENTS
     {nullptr, nullptr, 0, 0, 0, 0, 0}
 };
 
-const GFXglyph F3x5Glyphs_Fixed[] PROGMEM = {
-    { 198, 2, 1, 4, 1, -3 },   // '-'
-    {   0, 0, 0, 0, 0,  0 },   // '.'
-    { 505, 3, 5, 4, 0, -5 },   // To save space in the font, 'X' bitmap mapped to '/' character
-    { 483, 3, 5, 4, 0, -5 },   // '0'
-    { 127, 3, 5, 4, 0, -5 },   // '1'
-    {  68, 3, 5, 4, 0, -5 },   // '2'
-    { 485, 3, 5, 4, 0, -5 },   // '3'
-    { 128, 3, 5, 4, 0, -5 },   // '4'
-    { 487, 3, 5, 4, 0, -5 },   // '5'
-    { 489, 3, 5, 4, 0, -5 },   // '6'
-    { 153, 3, 5, 4, 0, -5 },   // '7'
-    { 102, 3, 5, 4, 0, -5 },   // '8'
-    { 173, 3, 5, 4, 0, -5 },   // '9'
-    { 197, 1, 3, 4, 1, -4 },   // ':'
+inline constexpr GFXglyph F3x5Glyphs_Fixed[] PROGMEM = {
+    { 179, 2, 1, 4, 1, -3 },   // '-'
+    {   0, 0, 0, 0, 0,  0 },   // '.', not in font
+    { 346, 3, 5, 4, 0, -5 },   // '/'
+    { 492, 3, 5, 4, 0, -5 },   // '0'
+    { 278, 3, 5, 4, 0, -5 },   // '1'
+    { 131, 3, 5, 4, 0, -5 },   // '2'
+    {   6, 3, 5, 4, 0, -5 },   // '3'
+    { 279, 3, 5, 4, 0, -5 },   // '4'
+    { 438, 3, 5, 4, 0, -5 },   // '5'
+    { 295, 3, 5, 4, 0, -5 },   // '6'
+    { 290, 3, 5, 4, 0, -5 },   // '7'
+    { 120, 3, 5, 4, 0, -5 },   // '8'
+    { 297, 3, 5, 4, 0, -5 },   // '9'
+    { 218, 1, 3, 4, 1, -4 },   // ':'
 };
 
-const GFXfont F3x5_Fixed PROGMEM = {
+inline constexpr GFXfont F3x5_Fixed PROGMEM = {
     (uint8_t  *) F3x5Bitmaps,
     (GFXglyph *) F3x5Glyphs_Fixed,
     45, 58, 6
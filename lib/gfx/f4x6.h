@@ -15,7 +15,7 @@ const uint8_t F4x6Bitmaps[] PROGMEM = {
     0b01110001, 0b00010001, 0b10100000 
 };
 
-const GFXglyph F4x6Glyphs[] PROGMEM = {
+constexpr GFXglyph F4x6Glyphs[] PROGMEM = {
     {     0, 3, 1, 4, 0, -3 },   // '-'
     {     0, 0, 0, 0, 0, 0 },    // '.'
     {     1, 4, 6, 5, 0, -6 },   // To save space in the font, 'X' bitmap mapped to '/' character
@@ -0,0 +1,90 @@
+// Class FontIndex - codepoint to glyph lookup over (segmented, UTF-8) GFX fonts
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "font_index.h"
+
+FontIndex FontIndex::indexes_[FONT_INDEX_MAX_FONTS];
+uint8_t FontIndex::indexCount_ = 0;
+
+FontIndex *FontIndex::get(const GFXfont *font, bool segmented, bool utf8) {
+    if (font == nullptr) {
+        return nullptr;
+    }
+    for (uint8_t i = 0; i < indexCount_; i++) {
+        FontIndex *index = &indexes_[i];
+        if (index->font_ == font && index->segmented_ == segmented && index->utf8_ == utf8) {
+            return index;
+        }
+    }
+    FontIndex *index = &indexes_[(indexCount_ < FONT_INDEX_MAX_FONTS) ? indexCount_++ : FONT_INDEX_MAX_FONTS - 1];
+    index->build(font, segmented, utf8);
+    return index;
+}
+
+void FontIndex::build(const GFXfont *font, bool segmented, bool utf8) {
+    font_ = font;
+    segmented_ = segmented;
+    utf8_ = utf8;
+    for (uint8_t i = 0; i < FONT_INDEX_CACHE_SIZE; i++) {
+        cache_[i] = { UINT32_MAX, nullptr, nullptr };
+    }
+
+    // segmented fonts end with a segment without glyphs
+    uint8_t count = 1;
+    if (segmented) {
+        for (const GFXfont *f = font; ; count++) {
+            f = utf8 ? (const GFXfont *) (((const UTF8_32BitFont *) f) + 1) : f + 1;
+            if (pgm_read_pointer(&f->glyph) == nullptr) {
+                break;
+            }
+        }
+    }
+    delete[] ranges_;
+    ranges_ = new Range[count];
+    rangeCount_ = count;
+
+    const GFXfont *f = font;
+    for (uint8_t i = 0; i < count; i++) {
+        Range r = { pgm_read_word(&f->first), pgm_read_word(&f->last), f };
+        if (utf8) {
+            const UTF8_32BitFont *utf8Font = (const UTF8_32BitFont *) f;
+            uint32_t dFirst = pgm_read_dword(&utf8Font->dFirst),
+                     dLast = pgm_read_dword(&utf8Font->dLast);
+            r.first = (dFirst != 0) ? dFirst : r.first;
+            r.last = (dLast != 0) ? dLast : r.last;
+        }
+        // keep sorted by the first codepoint, segments come mostly in order already
+        uint8_t j = i;
+        for (; j > 0 && ranges_[j - 1].first > r.first; j--) {
+            ranges_[j] = ranges_[j - 1];
+        }
+        ranges_[j] = r;
+        f = utf8 ? (const GFXfont *) (((const UTF8_32BitFont *) f) + 1) : f + 1;
+    }
+    firstGlyph_ = (const GFXglyph *) pgm_read_pointer(&ranges_[0].segment->glyph);
+}
+
+const GFXglyph *FontIndex::lookup(uint32_t cp, const GFXfont **segment) {
+    CacheEntry &entry = cache_[cp & (FONT_INDEX_CACHE_SIZE - 1)];
+    entry = { cp, nullptr, nullptr };
+    // last range starting at or below the codepoint
+    uint8_t lo = 0, hi = rangeCount_;
+    while (lo < hi) {
+        uint8_t mid = (lo + hi) / 2;
+        if (ranges_[mid].first <= cp) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo > 0 && cp <= ranges_[lo - 1].last) {
+        const Range &r = ranges_[lo - 1];
+        entry.glyph = ((const GFXglyph *) pgm_read_pointer(&r.segment->glyph)) + (cp - r.first);
+        entry.segment = r.segment;
+    } else if (cp == UTF8_REPLACEMENT_CHAR) {
+        entry.glyph = find('?', &entry.segment);
+    }
+    *segment = entry.segment;
+    return entry.glyph;
+}
@@ -0,0 +1,67 @@
+// Class FontIndex - codepoint to glyph lookup over (segmented, UTF-8) GFX fonts
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <utf832bitfont.h>
+#include <utf8_decoder.h>
+
+#define FONT_INDEX_MAX_FONTS 8
+#define FONT_INDEX_CACHE_SIZE 16    // power of two
+
+// Segment ranges of the font are copied into RAM once, sorted, and searched by
+// bisection instead of walking the segment array in flash for every character.
+// The lowest range (mostly ASCII) is resolved directly, other recently resolved
+// codepoints (found or not) are kept in a small direct-mapped cache.
+// find() writes the cache of the shared index, so it must not be called from two
+// tasks at once, e.g. measuring text outside of the display task.
+class FontIndex {
+public:
+    // Index shared by everybody using the font, built on first use. With more than
+    // FONT_INDEX_MAX_FONTS fonts in use the last slot gets rebuilt, so do not keep
+    // the pointer beyond the text being laid out.
+    static FontIndex *get(const GFXfont *font, bool segmented = false, bool utf8 = false);
+
+    // Glyph for the codepoint or nullptr if the font has none, *segment is set to
+    // the font segment owning the glyph (its bitmap and yAdvance apply).
+    // Fonts without U+FFFD (replacement char) render it as '?'.
+    inline const GFXglyph *find(uint32_t cp, const GFXfont **segment) {
+        if (cp - ranges_[0].first <= ranges_[0].last - ranges_[0].first) {
+            *segment = ranges_[0].segment;
+            return firstGlyph_ + (cp - ranges_[0].first);
+        }
+        const CacheEntry &entry = cache_[cp & (FONT_INDEX_CACHE_SIZE - 1)];
+        if (entry.cp == cp) {
+            *segment = entry.segment;
+            return entry.glyph;
+        }
+        return lookup(cp, segment);
+    }
+
+private:
+    struct Range {
+        uint32_t first, last;
+        const GFXfont *segment;
+    };
+    struct CacheEntry {
+        uint32_t cp;
+        const GFXglyph *glyph;
+        const GFXfont *segment;
+    };
+
+    const GFXfont *font_ = nullptr;
+    bool segmented_ = false, utf8_ = false;
+    Range *ranges_ = nullptr;
+    const GFXglyph *firstGlyph_ = nullptr; // glyphs of ranges_[0]
+    uint8_t rangeCount_ = 0;
+    CacheEntry cache_[FONT_INDEX_CACHE_SIZE];
+
+    static FontIndex indexes_[FONT_INDEX_MAX_FONTS];
+    static uint8_t indexCount_;
+
+    void build(const GFXfont *font, bool segmented, bool utf8);
+    const GFXglyph *lookup(uint32_t cp, const GFXfont **segment);
+};
@@ -0,0 +1,63 @@
+// Class GraphemeComposer - folds simple multi-codepoint graphemes into single glyphs
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "grapheme_composer.h"
+
+const FlagTable *GraphemeComposer::flags_ = nullptr;
+
+static inline bool isIgnorable(uint32_t cp) {
+    return cp == 0x200D                         // zero width joiner
+        || cp == 0x20E3                         // combining enclosing keycap
+        || (cp >= 0xFE00 && cp <= 0xFE0F)       // variation selectors
+        || (cp >= 0x1F3FB && cp <= 0x1F3FF)     // emoji skin tone modifiers
+        || (cp >= 0xE0020 && cp <= 0xE007F);    // tags
+}
+
+uint8_t GraphemeComposer::feedComposing(uint32_t cp, uint32_t *out) {
+    if (isIgnorable(cp)) {
+        return 0;
+    }
+    uint8_t n = 0;
+    if (cp >= REGIONAL_INDICATOR_A && cp <= REGIONAL_INDICATOR_Z) {
+        if (pending_ == 0) {
+            pending_ = cp;
+            return 0;
+        }
+        uint32_t f = flag(pending_ - REGIONAL_INDICATOR_A, cp - REGIONAL_INDICATOR_A);
+        if (f != 0) {
+            out[n++] = f;
+        } else {
+            out[n++] = pending_;
+            out[n++] = cp;
+        }
+        pending_ = 0;
+        return n;
+    }
+    if (pending_ != 0) {
+        out[n++] = pending_;
+        pending_ = 0;
+    }
+    out[n++] = cp;
+    return n;
+}
+
+uint8_t GraphemeComposer::finish(uint32_t *out) {
+    if (pending_ == 0) {
+        return 0;
+    }
+    *out = pending_;
+    pending_ = 0;
+    return 1;
+}
+
+uint32_t GraphemeComposer::flag(uint8_t a, uint8_t b) {
+    if (flags_ == nullptr) {
+        return 0;
+    }
+    uint32_t letters = pgm_read_dword(&flags_->letters[a]);
+    if (!(letters & (1UL << b))) {
+        return 0;
+    }
+    return flags_->first + pgm_read_byte(&flags_->index[a]) + __builtin_popcount(letters & ((1UL << b) - 1));
+}
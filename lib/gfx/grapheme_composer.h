@@ -0,0 +1,53 @@
+// Class GraphemeComposer - folds simple multi-codepoint graphemes into single glyphs
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+
+#define REGIONAL_INDICATOR_A 0x1F1E6
+#define REGIONAL_INDICATOR_Z 0x1F1FF
+
+// Flags precomposed as glyphs (sprites) of consecutive codepoints, generated by
+// tools/fontc.py. Flag of letters a, b (0 to 25) exists if bit b of letters[a] is
+// set, its codepoint is first + index[a] + count of the lower bits set in letters[a].
+struct FlagTable {
+    uint32_t first;
+    const uint8_t *index;       // [26] number of flags with a lower first letter
+    const uint32_t *letters;    // [26] second letters present, bit per letter
+};
+
+// Sits between the UTF-8 decoder and the glyph lookup, state is kept per instance
+// (one composer per stream):
+// - a pair of regional indicators listed in the flag table becomes the flag codepoint,
+//   other pairs go through unchanged (rendered as the indicator letters)
+// - variation selectors, zero width joiner, emoji skin tone modifiers, combining
+//   keycap and tag characters are dropped, so the base character is rendered alone
+class GraphemeComposer {
+public:
+    // Flag table for all text, its flags must be in the UTF-8 fonts used.
+    static void setFlags(const FlagTable *flags) { flags_ = flags; }
+
+    // Feed one codepoint, returns the number of codepoints (0 to 2) to render stored to out.
+    inline uint8_t feed(uint32_t cp, uint32_t *out) {
+        if (cp < 0x200D && pending_ == 0) { // nothing below ZWJ composes
+            *out = cp;
+            return 1;
+        }
+        return feedComposing(cp, out);
+    }
+
+    // End of the stream, returns 1 with a lone regional indicator left pending in out.
+    uint8_t finish(uint32_t *out);
+
+    inline void reset() { pending_ = 0; }
+    inline bool idle() const { return pending_ == 0; }
+
+private:
+    static const FlagTable *flags_;
+    uint32_t pending_ = 0;  // regional indicator waiting for its pair
+
+    uint8_t feedComposing(uint32_t cp, uint32_t *out);
+    static uint32_t flag(uint8_t a, uint8_t b);
+};
@@ -0,0 +1,100 @@
+// Class Layer - UTF-8 capable 16-bit canvas tracking its dirty region, for use with Compositor
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "layer.h"
+
+Layer::Layer(int16_t w, int16_t h) : UTF8canvas16(w, h) {
+    clearDirty();
+}
+
+// Only pixels really changing their color extend the dirty region, so redrawing
+// unchanged content (e.g. the countdown every second) costs no recompositing.
+inline void Layer::setPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height || buffer == nullptr) {
+        return;
+    }
+    uint16_t *p = &buffer[y * WIDTH + x];
+    if (*p == color) {
+        return;
+    }
+    *p = color;
+    if (x < dirtyX0_) dirtyX0_ = x;
+    if (y < dirtyY0_) dirtyY0_ = y;
+    if (x > dirtyX1_) dirtyX1_ = x;
+    if (y > dirtyY1_) dirtyY1_ = y;
+}
+
+void Layer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    setPixel(x, y, color);
+}
+
+void Layer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    for (int16_t i = 0; i < w; i++) {
+        setPixel(x + i, y, color);
+    }
+}
+
+void Layer::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    for (int16_t i = 0; i < h; i++) {
+        setPixel(x, y + i, color);
+    }
+}
+
+void Layer::glyphBlitted(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    markDirty(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+}
+
+void Layer::fillScreen(uint16_t color) {
+    for (int16_t y = 0; y < _height; y++) {
+        for (int16_t x = 0; x < _width; x++) {
+            setPixel(x, y, color);
+        }
+    }
+}
+
+void Layer::setVisible(bool visible) {
+    if (visible != visible_) {
+        visible_ = visible;
+        markDirty(0, 0, _width, _height);
+    }
+}
+
+void Layer::setOpaqueArea(int16_t x, int16_t y, int16_t w, int16_t h) {
+    markDirty(opaqueX_, opaqueY_, opaqueW_, opaqueH_);
+    opaqueX_ = x;
+    opaqueY_ = y;
+    opaqueW_ = w;
+    opaqueH_ = h;
+    markDirty(x, y, w, h);
+}
+
+bool Layer::getDirtyRegion(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1) const {
+    if (dirtyX0_ > dirtyX1_ || dirtyY0_ > dirtyY1_) {
+        return false;
+    }
+    *x0 = dirtyX0_;
+    *y0 = dirtyY0_;
+    *x1 = dirtyX1_;
+    *y1 = dirtyY1_;
+    return true;
+}
+
+void Layer::markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    int16_t x1 = _min(x + w - 1, _width - 1),
+            y1 = _min(y + h - 1, _height - 1);
+    x = _max(x, 0);
+    y = _max(y, 0);
+    if (x > x1 || y > y1) {
+        return;
+    }
+    if (x < dirtyX0_) dirtyX0_ = x;
+    if (y < dirtyY0_) dirtyY0_ = y;
+    if (x1 > dirtyX1_) dirtyX1_ = x1;
+    if (y1 > dirtyY1_) dirtyY1_ = y1;
+}
+
+void Layer::clearDirty() {
+    dirtyX0_ = dirtyY0_ = 0x7FFF;
+    dirtyX1_ = dirtyY1_ = -1;
+}
@@ -0,0 +1,43 @@
+// Class Layer - UTF-8 capable 16-bit canvas tracking its dirty region, for use with Compositor
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <utf8canvas16.h>
+
+// Color 0x0000 is transparent, unless the pixel lies within the opaque area of the layer.
+// Layers are expected not to be rotated.
+class Layer : public UTF8canvas16 {
+public:
+    Layer(int16_t w, int16_t h);
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+    void setVisible(bool visible);
+    inline bool isVisible() const { return visible_; }
+
+    void setOpaqueArea(int16_t x, int16_t y, int16_t w, int16_t h);
+    inline bool isOpaqueAt(int16_t x, int16_t y) const {
+        return x >= opaqueX_ && y >= opaqueY_ && x < opaqueX_ + opaqueW_ && y < opaqueY_ + opaqueH_;
+    }
+
+    // ---- Dirty region, inclusive coordinates ----
+    bool getDirtyRegion(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1) const;
+    void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+    void clearDirty();
+
+private:
+    bool visible_ = true;
+    int16_t opaqueX_ = 0, opaqueY_ = 0, opaqueW_ = 0, opaqueH_ = 0;
+    int16_t dirtyX0_, dirtyY0_, dirtyX1_, dirtyY1_;
+
+    inline void setPixel(int16_t x, int16_t y, uint16_t color);
+
+protected:
+    void glyphBlitted(int16_t x0, int16_t y0, int16_t x1, int16_t y1) override;
+};
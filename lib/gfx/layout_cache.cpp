@@ -0,0 +1,199 @@
+// Class LayoutCache - shared cache of measured and laid out single-line texts
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "layout_cache.h"
+
+static BlockPool<LAYOUT_CACHE_BLOCK_SIZE, LAYOUT_CACHE_POOL_SIZE> layoutPool("LayoutCache");
+
+TextLayout *LayoutCache::entries_[LAYOUT_CACHE_SIZE] = {};
+uint32_t LayoutCache::useCounter_ = 0;
+
+const MemoryPool &LayoutCache::pool() { return layoutPool; }
+
+const TextLayout *LayoutCache::acquire(const char *text, const GFXfont *font, bool segmented, bool utf8) {
+    if (font == nullptr) {
+        return nullptr;
+    }
+    uint32_t h = hash(text);
+    uint8_t slot = 0;
+    for (uint8_t i = 0; i < LAYOUT_CACHE_SIZE; i++) {
+        TextLayout *l = entries_[i];
+        if (l == nullptr) {
+            slot = i;
+            continue;
+        }
+        if (l->hash == h && l->font == font && l->segmented == segmented && l->utf8 == utf8 && strcmp(l->text, text) == 0) {
+            l->refs++;
+            l->lastUse = ++useCounter_;
+            return l;
+        }
+        if (entries_[slot] != nullptr && l->lastUse < entries_[slot]->lastUse) {
+            slot = i; // least recently used so far
+        }
+    }
+
+    TextLayout *l = layout(text, font, segmented, utf8);
+    if (l == nullptr) {
+        return nullptr;
+    }
+    l->hash = h;
+    l->font = font;
+    l->segmented = segmented;
+    l->utf8 = utf8;
+    l->refs = 1;
+    l->lastUse = ++useCounter_;
+    TextLayout *evicted = entries_[slot];
+    if (evicted != nullptr) {
+        evicted->cached = false;
+        if (evicted->refs == 0) {
+            destroy(evicted);
+        }
+    }
+    entries_[slot] = l;
+    l->cached = true;
+    return l;
+}
+
+void LayoutCache::release(const TextLayout *layout) {
+    if (layout == nullptr) {
+        return;
+    }
+    TextLayout *l = (TextLayout *) layout;
+    if (l->refs > 0) {
+        l->refs--;
+    }
+    if (l->refs == 0 && !l->cached) {
+        destroy(l);
+    }
+}
+
+void LayoutCache::getTextBounds(const char *text, const GFXfont *font, bool segmented, bool utf8, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) {
+    const TextLayout *l = acquire(text, font, segmented, utf8);
+    *x1 = x;
+    *y1 = y;
+    *w = *h = 0;
+    if (l != nullptr) {
+        if (l->width > 0) {
+            *x1 = x + l->x1;
+            *w = l->width;
+        }
+        if (l->height > 0) {
+            *y1 = y + l->y1;
+            *h = l->height;
+        }
+        release(l);
+    }
+}
+
+// FNV-1a
+uint32_t LayoutCache::hash(const char *text) {
+    uint32_t h = 2166136261u;
+    while (*text) {
+        h = (h ^ (uint8_t) *text++) * 16777619u;
+    }
+    return h;
+}
+
+TextLayout *LayoutCache::layout(const char *text, const GFXfont *font, bool segmented, bool utf8) {
+    FontIndex *index = FontIndex::get(font, segmented, utf8);
+    if (index == nullptr) {
+        return nullptr;
+    }
+    // measured first, to take the layout, its glyphs and the text in a single block of the exact size
+    TextLayout measured = {};
+    placeText(&measured, UINT16_MAX, index, text, utf8);
+    size_t len = strlen(text);
+    TextLayout *l = (TextLayout *) layoutPool.allocate(sizeof(TextLayout) + measured.glyphCount * sizeof(PlacedGlyph) + len + 1);
+    if (l == nullptr) {
+        return nullptr;
+    }
+    *l = TextLayout();
+    l->glyphs = (PlacedGlyph *) (l + 1);
+    l->text = (char *) (l->glyphs + measured.glyphCount);
+    memcpy(l->text, text, len + 1);
+    placeText(l, measured.glyphCount, index, text, utf8);
+    return l;
+}
+
+// Places the glyphs of the text into the layout, up to capacity, and measures it; without
+// glyphs given, they are just counted.
+void LayoutCache::placeText(TextLayout *l, uint16_t capacity, FontIndex *index, const char *text, bool utf8) {
+    int16_t x = 0;
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+    // Bound rect is intentionally initialized inverted, so 1st char sets it
+
+    UTF8Decoder decoder;
+    GraphemeComposer composer;
+    uint32_t cp[2], g[2];
+    uint8_t c; // Current character
+    // place() advances x for each character, and min/max x/y
+    // are updated to incrementally build bounding rect.
+    while ((c = *text++)) {
+        if (!utf8 || (c < 0x80 && decoder.idle() && composer.idle())) {
+            place(l, capacity, index, c, &x, &minx, &miny, &maxx, &maxy);
+            continue;
+        }
+        for (uint8_t i = 0, n = decoder.feed(c, cp); i < n; i++) {
+            for (uint8_t j = 0, m = composer.feed(cp[i], g); j < m; j++) {
+                place(l, capacity, index, g[j], &x, &minx, &miny, &maxx, &maxy);
+            }
+        }
+    }
+    if (decoder.finish(cp)) { // text ended within a multibyte sequence
+        for (uint8_t j = 0, m = composer.feed(cp[0], g); j < m; j++) {
+            place(l, capacity, index, g[j], &x, &minx, &miny, &maxx, &maxy);
+        }
+    }
+    if (composer.finish(g)) { // lone regional indicator at the end
+        place(l, capacity, index, g[0], &x, &minx, &miny, &maxx, &maxy);
+    }
+    if (maxx >= minx) {
+        l->x1 = minx;
+        l->width = maxx - minx + 1;
+    }
+    if (maxy >= miny) {
+        l->y1 = miny;
+        l->height = maxy - miny + 1;
+    }
+}
+
+void LayoutCache::place(TextLayout *l, uint16_t capacity, FontIndex *index, uint32_t cp, int16_t *x, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy) {
+    if (cp == '\n' || cp == '\r') {
+        return;
+    }
+    const GFXfont *segment;
+    const GFXglyph *glyph = index->find(cp, &segment);
+    if (glyph == nullptr) {
+        return; // Char not present in this font
+    }
+    uint8_t gw = pgm_read_byte(&glyph->width),
+            gh = pgm_read_byte(&glyph->height),
+            xa = pgm_read_byte(&glyph->xAdvance);
+    int8_t xo = pgm_read_byte(&glyph->xOffset),
+           yo = pgm_read_byte(&glyph->yOffset);
+    int16_t x1 = *x + xo, y1 = yo, x2 = x1 + gw - 1,
+            y2 = y1 + gh - 1;
+    if (x1 < *minx)
+        *minx = x1;
+    if (y1 < *miny)
+        *miny = y1;
+    if (x2 > *maxx)
+        *maxx = x2;
+    if (y2 > *maxy)
+        *maxy = y2;
+    // texts over UINT16_MAX glyphs get measured whole, but placed only up to capacity
+    if (gw > 0 && gh > 0 && l->glyphCount < capacity) {
+        l->glyphLead = _max(l->glyphLead, (int16_t) -xo);
+        l->glyphReach = _max(l->glyphReach, (int16_t) (xo + gw));
+        if (l->glyphs != nullptr) {
+            l->glyphs[l->glyphCount] = { glyph, (const uint8_t *) pgm_read_pointer(&segment->bitmap), *x };
+        }
+        l->glyphCount++;
+    }
+    *x += xa;
+}
+
+void LayoutCache::destroy(TextLayout *layout) {
+    layoutPool.release(layout);
+}
@@ -0,0 +1,72 @@
+// Class LayoutCache - shared cache of measured and laid out single-line texts
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <font_index.h>
+#include <utf8_decoder.h>
+#include <grapheme_composer.h>
+#include <memory_pool.h>
+
+#define LAYOUT_CACHE_SIZE 8
+// Each layout takes one block: the TextLayout, its glyphs and the copy of the text; a
+// block holds some 36 glyphs on the ESP32. Longer texts, as announcements, go to the heap.
+#define LAYOUT_CACHE_POOL_SIZE (LAYOUT_CACHE_SIZE + 4)   // cached and evicted still in use
+#define LAYOUT_CACHE_BLOCK_SIZE 512
+
+struct PlacedGlyph {
+    const GFXglyph *glyph;
+    const uint8_t *bitmap;  // bitmap of the font (segment) the glyph belongs to
+    int16_t x;              // pen position relative to the start of the text
+};
+
+// Text laid out on a single line, newlines and carriage returns are skipped.
+struct TextLayout {
+    int16_t x1, y1;         // bounding box relative to the pen start and the baseline
+    uint16_t width, height;
+    int16_t glyphLead;      // max -xOffset and max xOffset + width of the placed glyphs,
+    int16_t glyphReach;     // bound the glyphs which may cover a given column
+    uint16_t glyphCount;
+    PlacedGlyph *glyphs;    // ordered by x, glyphs without bitmap are left out; follow the TextLayout
+
+    // ---- Cache bookkeeping ----
+    uint32_t hash;
+    char *text;             // follows the glyphs
+    const GFXfont *font;
+    bool segmented, utf8;
+    bool cached;
+    uint16_t refs;
+    uint32_t lastUse;
+};
+
+// Event names, "Round N" and config messages are shown over and over; measuring
+// and laying them out once is enough. Layouts are keyed by (string hash, font),
+// the least recently used is evicted, those still in use are freed on release.
+// Layouts are allocated from a pool (see LAYOUT_CACHE_POOL_SIZE), not to fragment
+// the heap with texts changing over days of operation.
+// Entries are shared and evicted without locking, acquire() and release() must
+// not be called from more than one task.
+class LayoutCache {
+public:
+    // Layout of the text, to be given back by release() once not needed. nullptr
+    // if there is no font or no memory.
+    static const TextLayout *acquire(const char *text, const GFXfont *font, bool segmented = false, bool utf8 = false);
+    static void release(const TextLayout *layout);
+    static const MemoryPool &pool();
+
+    // Same as Adafruit GFX getTextBounds() for a single line of text
+    static void getTextBounds(const char *text, const GFXfont *font, bool segmented, bool utf8, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+
+private:
+    static TextLayout *entries_[LAYOUT_CACHE_SIZE];
+    static uint32_t useCounter_;
+
+    static uint32_t hash(const char *text);
+    static TextLayout *layout(const char *text, const GFXfont *font, bool segmented, bool utf8);
+    static void placeText(TextLayout *layout, uint16_t capacity, FontIndex *index, const char *text, bool utf8);
+    static void place(TextLayout *layout, uint16_t capacity, FontIndex *index, uint32_t cp, int16_t *x, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy);
+    static void destroy(TextLayout *layout);
+};
@@ -0,0 +1,20 @@
+// Fixed-size block pools in static storage, for objects created and destroyed over and over
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "memory_pool.h"
+
+MemoryPool *MemoryPool::first_ = nullptr;
+
+void MemoryPool::allocated(bool fromPool) {
+    if (!listed_) {
+        listed_ = true;
+        next_ = first_;
+        first_ = this;
+    }
+    inUse_++;
+    highWater_ = _max(highWater_, inUse_);
+    if (!fromPool) {
+        exhausted_++;
+    }
+}
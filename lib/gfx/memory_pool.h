@@ -0,0 +1,93 @@
+// Fixed-size block pools in static storage, for objects created and destroyed over and over
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <stddef.h>
+
+// Usage statistics, common to all pools. Pools get listed (see first()) once first used.
+class MemoryPool {
+public:
+    constexpr MemoryPool(const char *name, uint16_t capacity) : name_(name), capacity_(capacity) {}
+
+    inline const char *name() const { return name_; }
+    inline uint16_t capacity() const { return capacity_; }
+    inline uint16_t inUse() const { return inUse_; }
+    inline uint16_t highWater() const { return highWater_; }
+    inline uint32_t exhausted() const { return exhausted_; }  // allocations left to the heap
+
+    static MemoryPool *first() { return first_; }
+    inline MemoryPool *next() const { return next_; }
+
+protected:
+    void allocated(bool fromPool);
+    void released() { inUse_--; }
+
+private:
+    const char *name_;
+    uint16_t capacity_;
+    uint16_t inUse_ = 0, highWater_ = 0;
+    uint32_t exhausted_ = 0;
+    MemoryPool *next_ = nullptr;
+    bool listed_ = false;
+    static MemoryPool *first_;
+};
+
+// N blocks of SIZE bytes, reserved at build time so they never fragment the heap.
+// Allocations bigger than SIZE, or made with all blocks in use, fall back to the heap
+// and are counted as exhausted, so running out degrades rather than fails.
+// Not thread safe; used from the display task only.
+template <size_t SIZE, size_t N>
+class BlockPool : public MemoryPool {
+public:
+    constexpr BlockPool(const char *name) : MemoryPool(name, N) {}
+
+    void *allocate(size_t size) {
+        Block *b = nullptr;
+        if (size <= SIZE) {
+            if (free_ != nullptr) {
+                b = free_;
+                free_ = free_->next;
+            } else if (used_ < N) {
+                b = &blocks_[used_++];
+            }
+        }
+        allocated(b != nullptr);
+        return (b != nullptr) ? (void *) b : malloc(size);
+    }
+
+    // For class operator new: never nullptr, the constructor would run on it. Out of
+    // heap as well, it aborts, as the global operator new does without exceptions.
+    void *allocateObject(size_t size) {
+        void *p = allocate(size);
+        if (p == nullptr) {
+            abort();
+        }
+        return p;
+    }
+
+    void release(void *p) {
+        if (p == nullptr) {
+            return;
+        }
+        released();
+        if (p >= (void *) blocks_ && p < (void *) (blocks_ + N)) {
+            Block *b = (Block *) p;
+            b->next = free_;
+            free_ = b;
+        } else {
+            free(p);
+        }
+    }
+
+private:
+    union Block {
+        Block *next;
+        alignas(max_align_t) uint8_t bytes[SIZE];
+    };
+    Block blocks_[N] = {};
+    Block *free_ = nullptr;     // released blocks
+    uint16_t used_ = 0;         // blocks handed out at least once, the rest is untouched
+};
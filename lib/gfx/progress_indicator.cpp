@@ -4,6 +4,12 @@
 
 #include "progress_indicator.h"
 
+static BlockPool<sizeof(ProgressIndicator), PROGRESS_INDICATOR_POOL_SIZE> indicatorPool("ProgressIndicator");
+
+void *ProgressIndicator::operator new(size_t size) { return indicatorPool.allocateObject(size); }
+void ProgressIndicator::operator delete(void *p) { indicatorPool.release(p); }
+const MemoryPool &ProgressIndicator::pool() { return indicatorPool; }
+
 ProgressIndicator::ProgressIndicator(Adafruit_GFX *gfx, int16_t x, int16_t y, int16_t w, int16_t color, int16_t bgColor) : GFXanimation(gfx), x_(x), y_(y), w_(w), color_(color), bgColor_(bgColor) {
     isActive = true;
 };
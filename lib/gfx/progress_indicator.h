@@ -5,6 +5,9 @@
 #pragma once
 
 #include <animation.h>
+#include <memory_pool.h>
+
+#define PROGRESS_INDICATOR_POOL_SIZE 2
 
 class ProgressIndicator : public GFXanimation {
 public:
@@ -13,6 +16,11 @@ public:
     void draw() override;
     void hide();
 
+    // Allocated from a pool, see MemoryPool
+    static void *operator new(size_t size);
+    static void operator delete(void *p);
+    static const MemoryPool &pool();
+
 private:
     int16_t x_, y_, w_;
     int16_t position_ = 0;
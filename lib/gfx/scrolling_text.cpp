@@ -4,32 +4,28 @@
 
 #include "scrolling_text.h"
 
-void ScrollingText::_ScrollingText(Adafruit_GFX *gfx, const char *text, int16_t x, int16_t y, const GFXfont *gfxFont, bool segmentedFont, int16_t color, uint16_t lpad, uint16_t rpad, bool loop, bool draw) {
+static BlockPool<sizeof(ScrollingText), SCROLLING_TEXT_POOL_SIZE> textPool("ScrollingText");
+static BlockPool<SCROLLING_TEXT_WINDOW_PIXELS * sizeof(uint16_t), SCROLLING_TEXT_POOL_SIZE> windowPool_("ScrollingText window");
+
+void *ScrollingText::operator new(size_t size) { return textPool.allocateObject(size); }
+void ScrollingText::operator delete(void *p) { textPool.release(p); }
+const MemoryPool &ScrollingText::pool() { return textPool; }
+const MemoryPool &ScrollingText::windowPool() { return windowPool_; }
+
+ScrollingText::~ScrollingText() {
+    while (segments_ != nullptr) {
+        Segment *next = segments_->next;
+        LayoutCache::release(segments_->layout);
+        delete segments_;
+        segments_ = next;
+    }
+    windowPool_.release(window_);
+}
+
+void ScrollingText::_ScrollingText(const char *text, bool segmentedFont, int16_t color, bool draw) {
     isSegFont_ = segmentedFont;
-    int16_t x1;
-    uint16_t w, h;
-    textDimensions(text, &x1, &y1_, &w, &h);
-#ifdef _UTF8_32BIT_FONT_H_
-    if (isUTF8Font_) {
-        UTF8canvas16 *utf8Canvas = new UTF8canvas16(w, h);
-        if (isSegFont_) {
-            utf8Canvas->setFont((UTF8_32BitFont *) gfxFont, isSegFont_);
-        } else {
-            utf8Canvas->setFont((UTF8_32BitFont *) gfxFont);
-        }
-        scrollCanvas_ = utf8Canvas;
-    } else {
-#endif // _UTF8_32BIT_FONT_H_
-        scrollCanvas_ = new GFXcanvas16(w, h);
-        scrollCanvas_->setFont(gfxFont);
-#ifdef _UTF8_32BIT_FONT_H_
-    }
-#endif // _UTF8_32BIT_FONT_H_
-    scrollCanvas_->fillScreen(0x0000);
-    scrollCanvas_->setTextColor(color);
-    scrollCanvas_->setCursor(0, y_ - y1_); // align baseline between gfx and canvas
-    scrollCanvas_->print(text);
-    totalWidth_ = lpad_ + w + rpad_;
+    totalWidth_ = 0;
+    addSegment(text, color, lpad_, rpad_, &y1_, &h_);
     isActive = true;
     if (draw) {
         this->draw();
@@ -37,45 +33,26 @@ void ScrollingText::_ScrollingText(Adafruit_GFX *gfx, const char *text, int16_t
 }
 
 void ScrollingText::append(const char *text, int16_t color, bool newStart, uint16_t lpad, uint16_t rpad) {
-    int16_t x1, y1;
-    uint16_t w, h;
-    textDimensions(text, &x1, &y1, &w, &h);
+    uint16_t start = totalWidth_;
+    int16_t y1;
+    uint16_t h;
+    addSegment(text, color, lpad, rpad, &y1, &h);
     int16_t new_y1 = _min(y1_, y1);
-    uint16_t new_h = _max(y1_ + scrollCanvas_->height(), y1 + h) - new_y1;
-#ifdef _UTF8_32BIT_FONT_H_
-    UTF8canvas16 *newCanvas = new UTF8canvas16(scrollCanvas_->width() + rpad_ + lpad + w, new_h);
-#else
-    GFXcanvas16 *newCanvas = new GFXcanvas16(scrollCanvas_->width() + rpad_ + lpad + w, new_h);
-#endif // _UTF8_32BIT_FONT_H_
-    newCanvas->fillScreen(0x0000);
-    newCanvas->drawRGBBitmap(0, y1_ - new_y1, scrollCanvas_->getBuffer(), scrollCanvas_->width(), scrollCanvas_->height());
+    h_ = _max(y1_ + h_, y1 + h) - new_y1;
     y1_ = new_y1;
-    newCanvas->setFont(gfxFont_);
-    newCanvas->setTextColor(color);
-    newCanvas->setCursor(scrollCanvas_->width() + rpad_ + lpad, y_ - y1_); // baseline
-    newCanvas->print(text);
     if (newStart) {
-        startPos_ = scrollCanvas_->width() + rpad_ + lpad;
-        newLpad_ = lpad;
+        startPos_ = start;
     }
-    rpad_ = rpad;
-    totalWidth_ += lpad + w + rpad;
-    delete scrollCanvas_;
-    scrollCanvas_ = newCanvas;
+    windowValid_ = false; // strip beyond the old end has changed
 }
 
 void ScrollingText::step(bool draw) {
     pos_++;
-    if (pos_ > totalWidth_) {
-        if (loop_) {
-            if (newLpad_ != -256) {
-                lpad_ = newLpad_;
-                newLpad_ = -256;
-            }
-            pos_ = startPos_;
-        } else {
-            isActive = false;
-        }
+    steps_++;
+    if (loop_ && pos_ >= totalWidth_) {
+        pos_ = startPos_; // the strip continues seamlessly at the loop start
+    } else if (pos_ > totalWidth_) {
+        isActive = false;
     }
     if (draw) {
         this->draw();
@@ -83,169 +60,154 @@ void ScrollingText::step(bool draw) {
 }
 
 void ScrollingText::draw() {
-    int16_t drawPos = x_ - pos_;
-    uint16_t displayWidth = gfx_->width();
-    if (drawPos < displayWidth && drawPos + lpad_ > 0) {
-        gfx_->fillRect(_max(drawPos, 0), y1_, _min(lpad_, lpad_ + drawPos), scrollCanvas_->height(), 0x0000);
-    }
-    drawPos += lpad_;
-    if (drawPos < displayWidth && drawPos + scrollCanvas_->width() > 0) {
-        drawBitmap(drawPos, y1_, scrollCanvas_->getBuffer(), scrollCanvas_->width(), scrollCanvas_->height());
-    }
-    drawPos += scrollCanvas_->width();
-    if (drawPos < displayWidth && drawPos + rpad_ > 0) {    
-        gfx_->fillRect(_max(drawPos, 0), y1_, _min(rpad_, rpad_ + drawPos), scrollCanvas_->height(), 0x0000);
-    }
-    if (loop_) {
-        drawPos += rpad_;
-        if (drawPos < displayWidth) {
-            gfx_->fillRect(_max(drawPos, 0), y1_, _min(lpad_, lpad_ + drawPos), scrollCanvas_->height(), 0x0000);
-        }
-        drawPos += lpad_;
-        if (drawPos < displayWidth) {
-            drawBitmap(drawPos, y1_, scrollCanvas_->getBuffer(), _max(scrollCanvas_->width(), displayWidth), scrollCanvas_->height());
-        }
+    updateWindow();
+    if (window_ == nullptr) {
+        return;
     }
-}
-
-void ScrollingText::drawBitmap(int16_t x, int16_t y, uint16_t *bitmap, uint16_t w, uint16_t h) {
     gfx_->startWrite();
-    for (uint16_t j = 0; j < h; j++, y++) {
-        for (uint16_t i = 0; i < w; i++) {
-            gfx_->writePixel(x + i, y, *bitmap++);
+    const uint16_t *px = window_;
+    for (uint16_t j = 0; j < windowHeight_; j++) {
+        for (uint16_t i = 0; i < windowWidth_; i++) {
+            gfx_->writePixel(i, y1_ + j, *px++);
         }
     }
     gfx_->endWrite();
 }
 
-void ScrollingText::textDimensions(const char *str, int16_t *x1, int16_t *y1, uint16_t *width, uint16_t *height) {
-    int16_t x = x_, y = y_;
-    *x1 = x_; // Initial position is value passed in
-    *y1 = y_;
-    *width = *height = 0;
-    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
-    // Bound rect is intentionally initialized inverted, so 1st char sets it
+// Brings the window up to the current position: shift by the steps made since
+// the last render and rasterize only the entering columns, or render it whole.
+void ScrollingText::updateWindow() {
+    uint16_t w = gfx_->width();
+    if (windowWidth_ != w || windowHeight_ != h_) {
+        windowPool_.release(window_);
+        window_ = (h_ > 0) ? (uint16_t *) windowPool_.allocate(w * h_ * sizeof(uint16_t)) : nullptr;
+        windowWidth_ = (window_ != nullptr) ? w : 0;
+        windowHeight_ = (window_ != nullptr) ? h_ : 0;
+        windowValid_ = false;
+    }
+    if (window_ == nullptr) {
+        return;
+    }
+    int32_t first = (int32_t) pos_ - x_; // strip position of the display column 0
+    uint32_t shift = steps_ - windowSteps_;
+    uint16_t col = 0;
+    if (windowValid_ && shift < w) {
+        if (shift == 0) {
+            return;
+        }
+        for (uint16_t j = 0; j < windowHeight_; j++) {
+            uint16_t *row = window_ + j * w;
+            memmove(row, row + shift, (w - shift) * sizeof(uint16_t));
+        }
+        col = w - shift;
+    }
+    for (; col < w; col++) {
+        renderColumn(col, first + col);
+    }
+    windowSteps_ = steps_;
+    windowValid_ = true;
+}
 
-    uint8_t c; // Current character
-    while ((c = *str++)) {
-        // charBounds() modifies x/y to advance for each character,
-        // and min/max x/y are updated to incrementally build bounding rect.
-        charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+// Maps a position which may run past the strip end onto the strip: when looping,
+// the strip continues at the loop start, otherwise it is blank (-1).
+int32_t ScrollingText::stripColumn(int32_t pos) {
+    if (pos < 0) {
+        return -1;
     }
-    if (maxx >= minx) {
-        *x1 = minx;
-        *width = maxx - minx + 1;
+    if (pos < totalWidth_) {
+        return pos;
     }
-    if (maxy >= miny) {
-        *y1 = miny;
-        *height = maxy - miny + 1;
+    if (!loop_ || totalWidth_ <= startPos_) {
+        return -1;
     }
+    return startPos_ + (pos - totalWidth_) % (totalWidth_ - startPos_);
 }
 
-void ScrollingText::charBounds(const unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy) {
-    uint32_t cp = c;
-
-#ifdef _UTF8_32BIT_FONT_H_
-    if (isUTF8Font_) {
-        // handle UTF-8 decoding
-        static uint32_t utf8Char = 0;
-        static uint8_t utf8BytesExpected = 0;
-        if ((c & 0xE0) == 0xC0) { // 2-byte sequence
-            utf8Char = c & 0x1F;
-            utf8BytesExpected = 1;
-            return;
-        } else if ((c & 0xF0) == 0xE0) { // 3-byte sequence
-            utf8Char = c & 0x0F;
-            utf8BytesExpected = 2;
-            return;
-        } else if ((c & 0xF8) == 0xF0) { // 4-byte sequence
-            utf8Char = c & 0x07;
-            utf8BytesExpected = 3;
-            return;
-        } else if ((c & 0xC0) == 0x80 && utf8BytesExpected > 0) { // continuation byte
-            utf8Char = (utf8Char << 6) | (c & 0x3F);
-            utf8BytesExpected--;
-            if (utf8BytesExpected == 0) {
-                // complete character
-                cp = utf8Char;
-                utf8Char = 0;
-            } else {
-                return; // still not complete
-            }
-        }
+void ScrollingText::renderColumn(uint16_t col, int32_t pos) {
+    uint16_t *px = window_ + col;
+    for (uint16_t j = 0; j < windowHeight_; j++) {
+        px[j * windowWidth_] = 0x0000;
+    }
+    int32_t s = stripColumn(pos);
+    if (s < 0) {
+        return;
     }
-#endif // _UTF8_32BIT_FONT_H_
 
-    const GFXfont *font = gfxFont_;
+    Segment *seg = (cursor_ != nullptr && cursor_->start <= s) ? cursor_ : segments_;
+    while (seg != nullptr && seg->end <= s) {
+        seg = seg->next;
+    }
+    if (seg == nullptr) {
+        return;
+    }
+    cursor_ = seg;
+    const TextLayout *layout = seg->layout;
+    if (layout == nullptr) {
+        return;
+    }
+    s -= seg->textStart;
 
-    // handle segmented fonts
-    if (font != nullptr && isSegFont_) {
-        while (font->glyph != nullptr) {
-            uint32_t first = font->first;
-            uint32_t last = font->last;
-#ifdef _UTF8_32BIT_FONT_H_
-            if (isUTF8Font_) {
-                const UTF8_32BitFont *utf8Font = (const UTF8_32BitFont *) font;
-                first = (utf8Font->dFirst != 0) ? utf8Font->dFirst : first;
-                last = (utf8Font->dLast != 0) ? utf8Font->dLast : last;
-            }
-#endif // _UTF8_32BIT_FONT_H_
-            if (cp >= first && cp <= last) {
-                break;
-            } else {
-                // try next segment
-#ifdef _UTF8_32BIT_FONT_H_
-                if (isUTF8Font_) {
-                    font = (const GFXfont *) (((const UTF8_32BitFont *) font) + 1);
-                } else {
-#endif // _UTF8_32BIT_FONT_H_
-                    font = font + 1;
-#ifdef _UTF8_32BIT_FONT_H_
-                }
-#endif // _UTF8_32BIT_FONT_H_
+    // glyphs are ordered by pen position, find the last one which may cover the column
+    uint16_t lo = 0, hi = layout->glyphCount;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (layout->glyphs[mid].x <= s + layout->glyphLead) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    for (int32_t i = (int32_t) lo - 1; i >= 0 && layout->glyphs[i].x + layout->glyphReach > s; i--) {
+        const PlacedGlyph &pg = layout->glyphs[i];
+        uint8_t gw = pgm_read_byte(&pg.glyph->width),
+                gh = pgm_read_byte(&pg.glyph->height);
+        int8_t xo = pgm_read_byte(&pg.glyph->xOffset),
+               yo = pgm_read_byte(&pg.glyph->yOffset);
+        int16_t c = s - (pg.x + xo);
+        if (c < 0 || c >= gw) {
+            continue;
+        }
+        int16_t row = y_ + yo - y1_;
+        const uint16_t *colors = Sprites::colors(pg.bitmap);
+        if (colors != nullptr) {
+            Sprites::drawColumn(pg.glyph, pg.bitmap, colors, c, px, windowWidth_, row, windowHeight_);
+            continue;
+        }
+        const uint8_t *bitmap = pg.bitmap + pgm_read_word(&pg.glyph->bitmapOffset);
+        // glyph bits are packed continuously across rows, MSB first
+        for (uint16_t j = 0, bit = c; j < gh; j++, row++, bit += gw) {
+            if ((pgm_read_byte(&bitmap[bit >> 3]) & (0x80 >> (bit & 7))) && row >= 0 && row < windowHeight_) {
+                px[row * windowWidth_] = seg->color;
             }
         }
     }
+}
 
-    if (font == nullptr || font->glyph == nullptr) {
-        return; // Char not found
-    }
+BlockPool<sizeof(ScrollingText::Segment), SCROLLING_TEXT_SEGMENT_POOL_SIZE> &ScrollingText::segmentBlocks() {
+    static BlockPool<sizeof(Segment), SCROLLING_TEXT_SEGMENT_POOL_SIZE> blocks("ScrollingText segment");
+    return blocks;
+}
+
+void *ScrollingText::Segment::operator new(size_t size) { return segmentBlocks().allocateObject(size); }
+void ScrollingText::Segment::operator delete(void *p) { segmentBlocks().release(p); }
+const MemoryPool &ScrollingText::segmentPool() { return segmentBlocks(); }
 
-    if (cp == '\n') { // Newline?
-        *x = 0;        // Reset x to zero, advance y by one line
-        *y += (uint8_t) pgm_read_byte(&font->yAdvance);
-    } else if (cp != '\r') { // Not a carriage return; is normal char
-        uint32_t first = pgm_read_word(&font->first),
-                 last = pgm_read_word(&font->last);
+void ScrollingText::addSegment(const char *str, uint16_t color, uint16_t lpad, uint16_t rpad, int16_t *y1, uint16_t *height) {
 #ifdef _UTF8_32BIT_FONT_H_
-        if (isUTF8Font_) {
-            first = (((const UTF8_32BitFont *) font)->dFirst != 0) ? ((const UTF8_32BitFont *) font)->dFirst : first;
-            last = (((const UTF8_32BitFont *) font)->dLast != 0) ? ((const UTF8_32BitFont *) font)->dLast : last;
-        }
+    const TextLayout *layout = LayoutCache::acquire(str, gfxFont_, isSegFont_, isUTF8Font_);
+#else
+    const TextLayout *layout = LayoutCache::acquire(str, gfxFont_, isSegFont_);
 #endif // _UTF8_32BIT_FONT_H_
-        if ((cp >= first) && (cp <= last)) { // Char present in this font?
-            GFXglyph *glyph = pgm_read_glyph_ptr(font, cp - first);
-            uint8_t gw = pgm_read_byte(&glyph->width),
-                    gh = pgm_read_byte(&glyph->height),
-                    xa = pgm_read_byte(&glyph->xAdvance);
-            int8_t xo = pgm_read_byte(&glyph->xOffset),
-                    yo = pgm_read_byte(&glyph->yOffset);
-            // if (wrap && ((*x + (((int16_t)xo + gw) * textsize_x)) > _width)) {
-            //     *x = 0; // Reset x to zero, advance y by one line
-            //     *y += textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
-            // }
-            int16_t tsx = 1, tsy = 1,
-                    x1 = *x + xo * tsx, y1 = *y + yo * tsy, x2 = x1 + gw * tsx - 1,
-                    y2 = y1 + gh * tsy - 1;
-            if (x1 < *minx)
-                *minx = x1;
-            if (y1 < *miny)
-                *miny = y1;
-            if (x2 > *maxx)
-                *maxx = x2;
-            if (y2 > *maxy)
-                *maxy = y2;
-            *x += xa * tsx;
-        }
+    uint16_t width = (layout != nullptr) ? layout->width : 0;
+    *height = (layout != nullptr) ? layout->height : 0;
+    *y1 = (*height > 0) ? y_ + layout->y1 : y_;
+
+    Segment *seg = new Segment { nullptr, totalWidth_, (uint16_t) (totalWidth_ + lpad + width + rpad), (uint16_t) (totalWidth_ + lpad), color, layout };
+    if (lastSegment_ != nullptr) {
+        lastSegment_->next = seg;
+    } else {
+        segments_ = seg;
     }
+    lastSegment_ = seg;
+    totalWidth_ = seg->end;
 }
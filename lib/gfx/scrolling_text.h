@@ -7,8 +7,10 @@
 #include <Arduino.h>
 #include <Adafruit_GFX.h>
 #include <animation.h>
-#include <utf8canvas16.h>
 #include <utf832bitfont.h>
+#include <layout_cache.h>
+#include <sprite_atlas.h>
+#include <memory_pool.h>
 
 #define DEFAULT_LPAD 32
 #define DEFAULT_RPAD 0
@@ -16,24 +18,44 @@
 #define DEFAULT_LOOP true
 #define DEFAULT_DRAW true
 
+// Pools, reserved at build time and reused for the device lifetime (see MemoryPool)
+#define SCROLLING_TEXT_POOL_SIZE 4              // texts alive at once
+#define SCROLLING_TEXT_SEGMENT_POOL_SIZE 16     // segments of all texts alive
+#define SCROLLING_TEXT_BAND_HEIGHT 10           // tallest text band of the fonts in use
+#ifndef SCROLLING_TEXT_WINDOW_PIXELS            // window buffer, display width x text band height
+#define SCROLLING_TEXT_WINDOW_PIXELS (32 * SCROLLING_TEXT_BAND_HEIGHT)
+#endif
+
+// The text is laid out once into a list of placed glyphs (strip of lpad, text, rpad),
+// taken from LayoutCache, each appended text becomes another segment of the strip
+// chained after the previous.
+// Only a window of display width is kept as pixels; on each step it is shifted left
+// and just the newly entering columns are rasterized from the glyph bitmaps, so pixel
+// memory does not depend on the text length.
+// Texts, their segments and windows are allocated from pools, not to fragment the heap
+// with texts coming and going over days of operation.
 class ScrollingText : public GFXanimation {
 public:
-    ScrollingText(Adafruit_GFX *gfx, const char *text, int16_t x, int16_t y, const GFXfont *gfxFont, bool segmentedFont = false, int16_t color = DEFAULT_COLOR, uint16_t lpad = DEFAULT_LPAD, uint16_t rpad = DEFAULT_RPAD, bool loop = DEFAULT_LOOP, bool draw = DEFAULT_DRAW) : GFXanimation(gfx), x_(x), y_(y), gfxFont_(gfxFont), lpad_(lpad), rpad_(rpad), loop_(loop), startPos_(0), pos_(0), newLpad_(-256) {
-        _ScrollingText(gfx, text, x, y, gfxFont, segmentedFont, color, lpad, rpad, loop, draw);
+    ScrollingText(Adafruit_GFX *gfx, const char *text, int16_t x, int16_t y, const GFXfont *gfxFont, bool segmentedFont = false, int16_t color = DEFAULT_COLOR, uint16_t lpad = DEFAULT_LPAD, uint16_t rpad = DEFAULT_RPAD, bool loop = DEFAULT_LOOP, bool draw = DEFAULT_DRAW) : GFXanimation(gfx), x_(x), y_(y), gfxFont_(gfxFont), lpad_(lpad), rpad_(rpad), loop_(loop), startPos_(0), pos_(0) {
+        _ScrollingText(text, segmentedFont, color, draw);
     };
     ScrollingText(Adafruit_GFX *gfx, const String &text, int16_t x, int16_t y, const GFXfont *gfxFont, bool segmentedFont = false, int16_t color = DEFAULT_COLOR, uint16_t lpad = DEFAULT_LPAD, uint16_t rpad = DEFAULT_RPAD, bool loop = DEFAULT_LOOP, bool draw = DEFAULT_DRAW) : ScrollingText(gfx, text.c_str(), x, y, gfxFont, segmentedFont, color, lpad, rpad, loop, draw) {};
 
 #ifdef _UTF8_32BIT_FONT_H_
-    ScrollingText(Adafruit_GFX *gfx, const char *text, int16_t x, int16_t y, const UTF8_32BitFont *gfxFont, bool segmentedFont = false, int16_t color = DEFAULT_COLOR, uint16_t lpad = DEFAULT_LPAD, uint16_t rpad = DEFAULT_RPAD, bool loop = DEFAULT_LOOP, bool draw = DEFAULT_DRAW) : GFXanimation(gfx), x_(x), y_(y), gfxFont_((const GFXfont *) gfxFont), lpad_(lpad), rpad_(rpad), loop_(loop), startPos_(0), pos_(0), newLpad_(-256), isSegFont_(true) {
+    ScrollingText(Adafruit_GFX *gfx, const char *text, int16_t x, int16_t y, const UTF8_32BitFont *gfxFont, bool segmentedFont = false, int16_t color = DEFAULT_COLOR, uint16_t lpad = DEFAULT_LPAD, uint16_t rpad = DEFAULT_RPAD, bool loop = DEFAULT_LOOP, bool draw = DEFAULT_DRAW) : GFXanimation(gfx), x_(x), y_(y), gfxFont_((const GFXfont *) gfxFont), lpad_(lpad), rpad_(rpad), loop_(loop), startPos_(0), pos_(0), isSegFont_(true) {
         isUTF8Font_ = true;
-        _ScrollingText(gfx, text, x, y, (const GFXfont *) gfxFont, segmentedFont, color, lpad, rpad, loop, draw);
+        _ScrollingText(text, segmentedFont, color, draw);
     };
     ScrollingText(Adafruit_GFX *gfx, const String &text, int16_t x, int16_t y, const UTF8_32BitFont *gfxFont, bool segmentedFont = false, int16_t color = DEFAULT_COLOR, uint16_t lpad = DEFAULT_LPAD, uint16_t rpad = DEFAULT_RPAD, bool loop = DEFAULT_LOOP, bool draw = DEFAULT_DRAW) : ScrollingText(gfx, text.c_str(), x, y, gfxFont, segmentedFont, color, lpad, rpad, loop, draw) {};
 #endif // _UTF8_32BIT_FONT_H_
 
-    ~ScrollingText() {
-        if (scrollCanvas_ != nullptr) delete scrollCanvas_;
-    };
+    ~ScrollingText();
+
+    static void *operator new(size_t size);
+    static void operator delete(void *p);
+    static const MemoryPool &pool();
+    static const MemoryPool &segmentPool();
+    static const MemoryPool &windowPool();
 
     void append(const char *text, int16_t color = DEFAULT_COLOR, bool newStart = false, uint16_t lpad = DEFAULT_LPAD, uint16_t rpad = DEFAULT_RPAD);
     void append(const String &text, int16_t color = DEFAULT_COLOR, bool newStart = false, uint16_t lpad = DEFAULT_LPAD, uint16_t rpad = DEFAULT_RPAD) {
@@ -43,42 +65,47 @@ public:
     void draw() override;
 
 private:
+    struct Segment {
+        Segment *next;
+        uint16_t start, end;    // strip columns covered, including lpad and rpad
+        uint16_t textStart;     // strip column of the text pen start
+        uint16_t color;
+        const TextLayout *layout;
+
+        static void *operator new(size_t size);
+        static void operator delete(void *p);
+    };
+    static BlockPool<sizeof(Segment), SCROLLING_TEXT_SEGMENT_POOL_SIZE> &segmentBlocks();
+
     const GFXfont *gfxFont_;
     bool isSegFont_ = false;
 #ifdef _UTF8_32BIT_FONT_H_
     bool isUTF8Font_ = false;
 #endif // _UTF8_32BIT_FONT_H_
-    GFXcanvas16 *scrollCanvas_;
+    Segment *segments_ = nullptr, *lastSegment_ = nullptr;
+    Segment *cursor_ = nullptr;      // segment of the last rendered column, columns mostly come in order
     int16_t x_;
     int16_t y_;   // text baseline as per Adafruit GFX print text methods
-    int16_t y1_;  // scroll canvas top y position
+    int16_t y1_;  // top y position of the text band
+    uint16_t h_;  // height of the text band
     uint16_t lpad_, rpad_;
-    int16_t newLpad_;
     uint16_t totalWidth_;
     uint16_t startPos_, pos_;
     bool loop_;
 
-    void _ScrollingText(Adafruit_GFX *gfx, const char *text, int16_t x, int16_t y, const GFXfont *gfxFont, bool segmentedFont, int16_t color, uint16_t lpad, uint16_t rpad, bool loop, bool draw);
-
-    // We need to implement our own textDimensions() and charBounds() functions, as the
-    // Adafruit GFX versions clips the text to the display size, which we do not want here.
-    // We need full dimensions of the text even if it is larger than the display.
-    void textDimensions(const char *str, int16_t *x1, int16_t *y1, uint16_t *width, uint16_t *height);
-    void charBounds(const unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy);
-
-    // we need our own drawBitmap(), as the methods in Adafruit GFX work only
-    // with 1-bit bitmaps, not with 16-bit color bitmaps as used in our canvas
-    void drawBitmap(int16_t x, int16_t y, uint16_t *bitmap, uint16_t w, uint16_t h);
-
-    inline GFXglyph *pgm_read_glyph_ptr(const GFXfont *gfxFont, uint8_t c) {
-#ifdef __AVR__
-        return &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[c]);
-#else
-        // expression in __AVR__ section may generate "dereferencing type-punned
-        // pointer will break strict-aliasing rules" warning In fact, on other
-        // platforms (such as STM32) there is no need to do this pointer magic as
-        // program memory may be read in a usual way So expression may be simplified
-        return gfxFont->glyph + c;
-#endif //__AVR__
-    }
-};
\ No newline at end of file
+    uint16_t *window_ = nullptr;     // visible part of the strip, display width x text band height
+    uint16_t windowWidth_ = 0, windowHeight_ = 0;
+    uint32_t steps_ = 0, windowSteps_ = 0;
+    bool windowValid_ = false;
+
+    void _ScrollingText(const char *text, bool segmentedFont, int16_t color, bool draw);
+
+    // Adds the text as a new segment at the end of the strip and returns the text
+    // band. Unlike the Adafruit GFX getTextBounds() the text is not clipped to the
+    // display size, we need its full width.
+    void addSegment(const char *str, uint16_t color, uint16_t lpad, uint16_t rpad, int16_t *y1, uint16_t *height);
+
+    int32_t stripColumn(int32_t pos);
+    void renderColumn(uint16_t col, int32_t pos);
+    void updateWindow();
+};
@@ -0,0 +1,49 @@
+// Sprite atlas - palette + run-length coded color sprites, rendered inline as font glyphs
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "sprite_atlas.h"
+
+Sprites::Entry Sprites::atlases_[SPRITES_MAX_ATLASES];
+uint8_t Sprites::count_ = 0;
+
+bool Sprites::add(const SpriteAtlas *atlas, uint16_t colorBase) {
+    if (atlas == nullptr || count_ >= SPRITES_MAX_ATLASES) {
+        return false;
+    }
+    Entry &e = atlases_[count_];
+    e.sprites = atlas->sprites;
+    for (uint8_t i = 0; i < SPRITES_MAX_COLORS; i++) {
+        if (i >= atlas->paletteSize) {
+            e.colors[i] = 0;
+        } else if (colorBase != SPRITES_RGB565) {
+            e.colors[i] = colorBase + i;
+        } else {
+            const uint8_t *rgb = atlas->palette + 3 * i;
+            uint8_t r = pgm_read_byte(&rgb[0]), g = pgm_read_byte(&rgb[1]), b = pgm_read_byte(&rgb[2]);
+            e.colors[i] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+        }
+    }
+    count_++;
+    return true;
+}
+
+void Sprites::drawColumn(const GFXglyph *glyph, const uint8_t *sprites, const uint16_t *colors, uint8_t col, uint16_t *out, uint16_t stride, int16_t top, uint16_t height) {
+    uint8_t w = pgm_read_byte(&glyph->width);
+    SpriteRuns runs(glyph, sprites);
+    uint16_t pos;
+    uint8_t length, index;
+    while (runs.next(&pos, &length, &index)) {
+        if (index == 0) {
+            continue;
+        }
+        // first pixel of the run in the column, then every row down
+        uint16_t x = pos % w;
+        uint16_t p = pos + ((x <= col) ? col - x : w - x + col);
+        for (int16_t row = top + p / w; p < pos + length; p += w, row++) {
+            if (row >= 0 && row < (int16_t) height) {
+                out[row * stride] = colors[index];
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+// Sprite atlas - palette + run-length coded color sprites, rendered inline as font glyphs
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+#define SPRITES_MAX_ATLASES 4
+#define SPRITES_MAX_COLORS 16
+#define SPRITES_RGB565 0xFFFF
+
+// Atlas in flash, generated by tools/fontc.py. Sprites are addressed by codepoint as
+// glyphs of font segments whose bitmap is the atlas sprite data: GFXglyph gives size,
+// offsets and advance as for any other glyph, bitmapOffset points to the sprite runs.
+// A sprite is coded row by row as runs of one byte each, upper nibble is the run
+// length - 1, lower nibble the palette index, index 0 is transparent.
+struct SpriteAtlas {
+    const uint8_t *sprites;
+    const uint8_t *palette;     // RGB triples
+    uint8_t paletteSize;        // at most SPRITES_MAX_COLORS
+};
+
+// Walks the runs of a sprite, pixel positions count row by row from its top left.
+class SpriteRuns {
+public:
+    SpriteRuns(const GFXglyph *glyph, const uint8_t *sprites) : p_(sprites + pgm_read_word(&glyph->bitmapOffset)),
+        size_((uint16_t) pgm_read_byte(&glyph->width) * pgm_read_byte(&glyph->height)) {}
+
+    inline bool next(uint16_t *pos, uint8_t *length, uint8_t *index) {
+        if (pos_ >= size_) {
+            return false;
+        }
+        uint8_t b = pgm_read_byte(p_++);
+        *pos = pos_;
+        *length = _min((uint16_t) ((b >> 4) + 1), (uint16_t) (size_ - pos_));
+        *index = b & 0x0F;
+        pos_ += *length;
+        return true;
+    }
+
+private:
+    const uint8_t *p_;
+    uint16_t pos_ = 0, size_;
+};
+
+// Registry of atlases in use, glyph renderers ask it whether a bitmap holds sprites.
+// It is not locked, add() atlases at startup, before any text gets drawn.
+class Sprites {
+public:
+    // Palette entry i of the atlas is drawn as color colorBase + i (e.g. an index into
+    // the compositor palette), or converted to RGB565 with SPRITES_RGB565.
+    static bool add(const SpriteAtlas *atlas, uint16_t colorBase = SPRITES_RGB565);
+
+    // Colors of the registered atlas owning the font segment bitmap, nullptr for glyphs.
+    static inline const uint16_t *colors(const uint8_t *bitmap) {
+        for (uint8_t i = 0; i < count_; i++) {
+            if (atlases_[i].sprites == bitmap) {
+                return atlases_[i].colors;
+            }
+        }
+        return nullptr;
+    }
+
+    // Draws column col of the sprite into out[row * stride] for rows 0 to height - 1,
+    // the sprite top being at row top. Transparent pixels are left untouched.
+    static void drawColumn(const GFXglyph *glyph, const uint8_t *sprites, const uint16_t *colors, uint8_t col, uint16_t *out, uint16_t stride, int16_t top, uint16_t height);
+
+private:
+    struct Entry {
+        const uint8_t *sprites;
+        uint16_t colors[SPRITES_MAX_COLORS];
+    };
+    static Entry atlases_[SPRITES_MAX_ATLASES];
+    static uint8_t count_;
+};
@@ -0,0 +1,48 @@
+// Class UTF8Decoder - reentrant table-driven UTF-8 decoder
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "utf8_decoder.h"
+
+// Byte classes:
+//  0 00..7F ASCII          4 C2..DF 2-byte lead    8 F0       4-byte lead, then 90..BF
+//  1 80..8F continuation   5 E0     then A0..BF    9 F1..F3   4-byte lead
+//  2 90..9F continuation   6 E1..EC, EE..EF        10 F4      4-byte lead, then 80..8F
+//  3 A0..BF continuation   7 ED     then 80..9F    11 C0, C1, F5..FF never valid
+const uint8_t UTF8Decoder::byteClass_[128] = {
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,   // 80
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,   // 90
+     3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,   // A0
+     3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,   // B0
+    11, 11,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,   // C0
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,   // D0
+     5,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  7,  6,  6,   // E0
+     8,  9,  9,  9, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,   // F0
+};
+
+// payload bits of the lead byte per class
+const uint8_t UTF8Decoder::leadMask_[] = { 0x7F, 0, 0, 0, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0 };
+
+// States: 0 accept, 1 one continuation left, 2 two left, 3 two left (first A0..BF),
+// 4 two left (first 80..9F), 5 three left, 6 three left (first 90..BF),
+// 7 three left (first 80..8F), 8 reject
+const uint8_t UTF8Decoder::transitions_[][12] = {
+    //  0  1  2  3  4  5  6  7  8  9 10 11   byte class
+    {   0, 8, 8, 8, 1, 3, 2, 4, 6, 5, 7, 8 },    // 0
+    {   8, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8 },    // 1
+    {   8, 1, 1, 1, 8, 8, 8, 8, 8, 8, 8, 8 },    // 2
+    {   8, 8, 8, 1, 8, 8, 8, 8, 8, 8, 8, 8 },    // 3
+    {   8, 1, 1, 8, 8, 8, 8, 8, 8, 8, 8, 8 },    // 4
+    {   8, 2, 2, 2, 8, 8, 8, 8, 8, 8, 8, 8 },    // 5
+    {   8, 8, 2, 2, 8, 8, 8, 8, 8, 8, 8, 8 },    // 6
+    {   8, 2, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8 },    // 7
+};
+
+uint8_t UTF8Decoder::finish(uint32_t *cp) {
+    if (state_ == ACCEPT) {
+        return 0;
+    }
+    state_ = ACCEPT;
+    *cp = UTF8_REPLACEMENT_CHAR;
+    return 1;
+}
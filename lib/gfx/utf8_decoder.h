@@ -0,0 +1,68 @@
+// Class UTF8Decoder - reentrant table-driven UTF-8 decoder
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+
+#define UTF8_REPLACEMENT_CHAR 0xFFFD
+
+// Decodes a byte stream into codepoints, with the state kept per instance (one
+// decoder per stream). Bytes are classified by a table and a transition table
+// drives the state, rejecting overlong forms, surrogates and codepoints beyond
+// U+10FFFF. Each maximal invalid subsequence yields U+FFFD, as recommended by
+// Unicode (and done by most decoders).
+class UTF8Decoder {
+public:
+    // Feed one byte, returns the number of codepoints completed and stored to cp
+    // (0 to 2, a byte interrupting a sequence can complete a codepoint by itself,
+    // after the replacement char for the interrupted sequence).
+    inline uint8_t feed(uint8_t c, uint32_t *cp) {
+        if (c < 0x80 && state_ == ACCEPT) { // ASCII fast path
+            *cp = c;
+            return 1;
+        }
+        return feedMultibyte(c, cp);
+    }
+
+    // End of the stream, returns 1 with replacement char in cp if a sequence was left incomplete
+    uint8_t finish(uint32_t *cp);
+
+    inline void reset() { state_ = ACCEPT; }
+    inline bool idle() const { return state_ == ACCEPT; }
+
+private:
+    enum : uint8_t { ACCEPT = 0, REJECT = 8 };
+    uint8_t state_ = ACCEPT;
+    uint32_t codepoint_ = 0;
+
+    static const uint8_t byteClass_[128];   // classes of bytes 0x80..0xFF, ASCII is class 0
+    static const uint8_t leadMask_[];
+    static const uint8_t transitions_[][12];
+
+    inline uint8_t feedMultibyte(uint8_t c, uint32_t *cp) {
+        uint8_t n = 0;
+        uint8_t cls = (c < 0x80) ? 0 : byteClass_[c - 0x80];
+        uint8_t next = transitions_[state_][cls];
+        if (next == REJECT) {
+            cp[n++] = UTF8_REPLACEMENT_CHAR;
+            if (state_ == ACCEPT) {
+                return n; // stray continuation or invalid byte
+            }
+            // the byte interrupted a sequence, it may well start a new one
+            state_ = ACCEPT;
+            next = transitions_[ACCEPT][cls];
+            if (next == REJECT) {
+                cp[n++] = UTF8_REPLACEMENT_CHAR;
+                return n;
+            }
+        }
+        codepoint_ = (state_ == ACCEPT) ? (c & leadMask_[cls]) : (codepoint_ << 6) | (c & 0x3F);
+        state_ = next;
+        if (state_ == ACCEPT) {
+            cp[n++] = codepoint_;
+        }
+        return n;
+    }
+};
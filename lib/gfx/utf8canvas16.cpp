@@ -16,90 +16,197 @@ void UTF8canvas16::setFont(const UTF8_32BitFont *utf8Font, bool segmented) {
 }
 
 size_t UTF8canvas16::write(uint8_t c) {
+    if (!isUTF8Font_ || (c < 0x80 && decoder_.idle() && composer_.idle())) {
+        return writeCodepoint(c);
+    }
+    uint32_t cp[2], g[2];
+    size_t res = 0;
+    for (uint8_t i = 0, n = decoder_.feed(c, cp); i < n; i++) {
+        for (uint8_t j = 0, m = composer_.feed(cp[i], g); j < m; j++) {
+            res = writeCodepoint(g[j]);
+        }
+    }
+    return res;
+}
+
+size_t UTF8canvas16::write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        n += write(*buffer++);
+    }
+    if (!isUTF8Font_) {
+        return n;
+    }
+    uint32_t cp, g[2];
+    if (decoder_.finish(&cp)) { // buffer ended within a multibyte sequence
+        for (uint8_t j = 0, m = composer_.feed(cp, g); j < m; j++) {
+            writeCodepoint(g[j]);
+        }
+    }
+    if (composer_.finish(g)) { // lone regional indicator at the end
+        writeCodepoint(g[0]);
+    }
+    return n;
+}
+
+size_t UTF8canvas16::writeCodepoint(uint32_t cp) {
     const GFXfont *font = gfxFont;
-    uint32_t cp = c;
-    static uint32_t utf8Char = 0;
-    static uint8_t utf8BytesExpected = 0;
+    if (font == nullptr) {
+        // classic built-in font
+        return GFXcanvas16::write((uint8_t) cp);
+    }
 
-    if (isUTF8Font_) {
-        if (c < 0x80) {
-            // single byte ASCII
-            return GFXcanvas16::write(c);
-        } else if ((c & 0xE0) == 0xC0) {
-            // start of 2-byte sequence
-            utf8Char = c & 0x1F;
-            utf8BytesExpected = 1;
-            return 0;
-        } else if ((c & 0xF0) == 0xE0) {
-            // start of 3-byte sequence
-            utf8Char = c & 0x0F;
-            utf8BytesExpected = 2;
+    if (cp == '\n') {
+        cursor_x = 0;
+        cursor_y += (int16_t) textsize_y * (uint8_t) pgm_read_byte(&font->yAdvance);
+    } else if (cp != '\r') {
+        const GFXfont *segment;
+        const GFXglyph *glyph = FontIndex::get(font, isFontSegmented_, isUTF8Font_)->find(cp, &segment);
+        if (glyph == nullptr) {
             return 0;
-        } else if ((c & 0xF8) == 0xF0) {
-            // start of 4-byte sequence
-            utf8Char = c & 0x07;
-            utf8BytesExpected = 3;
-            return 0;
-        } else if ((c & 0xC0) == 0x80 && utf8BytesExpected > 0) {
-            // continuation byte
-            utf8Char = (utf8Char << 6) | (c & 0x3F);
-            utf8BytesExpected--;
-            if (utf8BytesExpected == 0) {
-                cp = utf8Char;
-                utf8Char = 0;
-            } else {
-                return 0; // still not complete
+        }
+        uint8_t w = pgm_read_byte(&glyph->width),
+                h = pgm_read_byte(&glyph->height);
+        if (w > 0 && h > 0) {
+            int16_t xo = (int8_t) pgm_read_byte(&glyph->xOffset);
+            if (wrap && (cursor_x + textsize_x * (xo + w)) > _width) {
+                cursor_x = 0;
+                cursor_y += (int16_t) textsize_y * (uint8_t) pgm_read_byte(&font->yAdvance);
             }
-        } else {
-            // invalid byte, reset state
-            utf8Char = 0;
-            utf8BytesExpected = 0;
-            return 0;
+            drawGlyph(glyph, (const uint8_t *) pgm_read_pointer(&segment->bitmap), textcolor);
         }
+        cursor_x += (uint8_t) pgm_read_byte(&glyph->xAdvance) * (int16_t) textsize_x;
+    }
+    return 1;
+}
+
+// Glyph bits are packed continuously across rows, MSB first. Each row is unpacked
+// straight into the buffer row, only scaled or rotated text goes pixel by pixel.
+void UTF8canvas16::drawGlyph(const GFXglyph *glyph, const uint8_t *bitmap, uint16_t color) {
+    const uint16_t *colors = Sprites::colors(bitmap);
+    if (colors != nullptr) {
+        drawSprite(glyph, bitmap, colors);
+        return;
     }
-    // now we have a complete UTF-8 character
+    uint8_t w = pgm_read_byte(&glyph->width),
+            h = pgm_read_byte(&glyph->height);
+    int8_t xo = pgm_read_byte(&glyph->xOffset),
+           yo = pgm_read_byte(&glyph->yOffset);
+    bitmap += pgm_read_word(&glyph->bitmapOffset);
 
-    if (font == nullptr) {
-        return GFXcanvas16::write((char) cp);
+    if (buffer == nullptr || getRotation() != 0 || textsize_x != 1 || textsize_y != 1) {
+        uint8_t bits = 0;
+        uint16_t bit = 0;
+        startWrite();
+        for (uint8_t yy = 0; yy < h; yy++) {
+            for (uint8_t xx = 0; xx < w; xx++, bit++) {
+                if (!(bit & 7)) {
+                    bits = pgm_read_byte(&bitmap[bit >> 3]);
+                }
+                if (bits & 0x80) {
+                    writeFillRect(cursor_x + (xo + xx) * textsize_x, cursor_y + (yo + yy) * textsize_y, textsize_x, textsize_y, color);
+                }
+                bits <<= 1;
+            }
+        }
+        endWrite();
+        return;
     }
 
-    size_t res = 0;
-    while (true) {
-        uint32_t first = font->first;
-        uint32_t last = font->last;
-        if (isUTF8Font_) {
-            first = (((const UTF8_32BitFont *) font)->dFirst != 0) ? ((const UTF8_32BitFont *) font)->dFirst : first;
-            last = (((const UTF8_32BitFont *) font)->dLast != 0) ? ((const UTF8_32BitFont *) font)->dLast : last;
+    int16_t x = cursor_x + xo, y = cursor_y + yo;
+    int16_t xs = _max(0, -x), xe = _min((int16_t) w, (int16_t) (WIDTH - x)); // columns within the canvas
+    int16_t x0 = 0x7FFF, y0 = 0x7FFF, x1 = -1, y1 = -1; // changed box, initialized inverted
+    for (uint8_t yy = 0; yy < h; yy++, y++) {
+        if (y < 0 || y >= HEIGHT || xs >= xe) {
+            continue;
         }
-        if (cp >= first && cp <= last) {
-            const GFXfont tmpFont = {
-                (uint8_t  *) font->bitmap,
-                (GFXglyph *) font->glyph + (cp - first),
-                0,
-                0,
-                font->yAdvance
-            };
-            const GFXfont *font1 = gfxFont;
-            GFXcanvas16::setFont(&tmpFont);
-            c = 0;
-            res = GFXcanvas16::write(c);
-            GFXcanvas16::setFont(font1);
-            break;
-        } else if (isFontSegmented_) {
-            // try next segment
-            if (isUTF8Font_) {
-                font = (const GFXfont *) (((const UTF8_32BitFont *) font) + 1);
-            } else {
-                font = font + 1;
+        uint16_t *row = buffer + y * WIDTH + x;
+        uint16_t bit = yy * w;
+        const uint8_t *p = bitmap + (bit >> 3);
+        uint8_t shift = bit & 7;
+        if (shift + w <= 32) {
+            // whole row in one MSB aligned word
+            uint32_t bits = 0;
+            for (uint8_t i = 0, n = (shift + w + 7) >> 3; i < n; i++) {
+                bits |= (uint32_t) pgm_read_byte(&p[i]) << (24 - 8 * i);
             }
-            if (font->glyph == nullptr) {
-                // no more segments
-                break;
+            bits <<= shift + xs;
+            for (int16_t xx = xs; xx < xe; xx++, bits <<= 1) {
+                if ((bits & 0x80000000) && row[xx] != color) {
+                    row[xx] = color;
+                    if (xx < x0) x0 = xx;
+                    if (xx > x1) x1 = xx;
+                    if (y < y0) y0 = y;
+                    y1 = y;
+                }
             }
         } else {
-            break;
+            for (int16_t xx = xs; xx < xe; xx++) {
+                uint16_t b = bit + xx;
+                if ((pgm_read_byte(&bitmap[b >> 3]) & (0x80 >> (b & 7))) && row[xx] != color) {
+                    row[xx] = color;
+                    if (xx < x0) x0 = xx;
+                    if (xx > x1) x1 = xx;
+                    if (y < y0) y0 = y;
+                    y1 = y;
+                }
+            }
         }
     }
-    utf8Char = 0;
-    return res;
-}
\ No newline at end of file
+    if (x1 >= 0) {
+        glyphBlitted(x + x0, y0, x + x1, y1);
+    }
+}
+
+// Sprite runs are split at row ends and written into the buffer as spans.
+void UTF8canvas16::drawSprite(const GFXglyph *glyph, const uint8_t *sprites, const uint16_t *colors) {
+    uint8_t w = pgm_read_byte(&glyph->width);
+    int8_t xo = pgm_read_byte(&glyph->xOffset),
+           yo = pgm_read_byte(&glyph->yOffset);
+    SpriteRuns runs(glyph, sprites);
+    uint16_t pos;
+    uint8_t length, index;
+
+    if (buffer == nullptr || getRotation() != 0 || textsize_x != 1 || textsize_y != 1) {
+        startWrite();
+        while (runs.next(&pos, &length, &index)) {
+            for (uint16_t p = pos; index != 0 && p < pos + length; p++) {
+                writeFillRect(cursor_x + (xo + p % w) * textsize_x, cursor_y + (yo + p / w) * textsize_y, textsize_x, textsize_y, colors[index]);
+            }
+        }
+        endWrite();
+        return;
+    }
+
+    int16_t x = cursor_x + xo, y = cursor_y + yo;
+    int16_t xs = _max(0, -x), xe = _min((int16_t) w, (int16_t) (WIDTH - x)); // columns within the canvas
+    int16_t x0 = 0x7FFF, y0 = 0x7FFF, x1 = -1, y1 = -1; // changed box, initialized inverted
+    while (runs.next(&pos, &length, &index)) {
+        if (index == 0) {
+            continue;
+        }
+        uint16_t color = colors[index];
+        int16_t xx = pos % w, yy = y + pos / w;
+        while (length > 0) {
+            uint8_t span = _min((int16_t) length, (int16_t) (w - xx));
+            if (yy >= 0 && yy < HEIGHT) {
+                uint16_t *row = buffer + yy * WIDTH + x;
+                for (int16_t i = _max(xx, xs), e = _min((int16_t) (xx + span), xe); i < e; i++) {
+                    if (row[i] != color) {
+                        row[i] = color;
+                        if (i < x0) x0 = i;
+                        if (i > x1) x1 = i;
+                        if (yy < y0) y0 = yy;
+                        if (yy > y1) y1 = yy;
+                    }
+                }
+            }
+            length -= span;
+            xx = 0;
+            yy++;
+        }
+    }
+    if (x1 >= 0) {
+        glyphBlitted(x + x0, y0, x + x1, y1);
+    }
+}
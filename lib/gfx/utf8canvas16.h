@@ -8,17 +8,35 @@
 #include <Arduino.h>
 #include <Adafruit_GFX.h>
 #include <utf832bitfont.h>
+#include <font_index.h>
+#include <utf8_decoder.h>
+#include <grapheme_composer.h>
+#include <sprite_atlas.h>
 
 class UTF8canvas16 : public GFXcanvas16 {
 public:
     UTF8canvas16(int16_t w, int16_t h) : GFXcanvas16(w, h) {}
     size_t write(uint8_t c) override;
+    // Neither sequences nor graphemes span writes of a buffer (print() of a string): a
+    // truncated sequence at its end ends as U+FFFD, a lone regional indicator gets drawn.
+    size_t write(const uint8_t *buffer, size_t size) override;
     void setFont(const GFXfont *f = NULL, bool segmented = false);
     void setFont(const UTF8_32BitFont *utf8Font, bool segmented = false);
 
+protected:
+    // Glyphs are blitted straight into the buffer, bypassing drawPixel(). Called
+    // afterwards with the box (inclusive) of the pixels which changed their color.
+    virtual void glyphBlitted(int16_t /* x0 */, int16_t /* y0 */, int16_t /* x1 */, int16_t /* y1 */) {}
+
 private:
     bool isFontSegmented_ = false;
     bool isUTF8Font_ = false;
+    UTF8Decoder decoder_;
+    GraphemeComposer composer_;
+
+    size_t writeCodepoint(uint32_t cp);
+    void drawGlyph(const GFXglyph *glyph, const uint8_t *bitmap, uint16_t color);
+    void drawSprite(const GFXglyph *glyph, const uint8_t *sprites, const uint16_t *colors);
 };
 
 #endif // _UTF8CANVAS16_H_
\ No newline at end of file
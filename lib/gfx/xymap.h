@@ -0,0 +1,75 @@
+// Compile-time XY lookup table for LED matrices wired as per NEO_MATRIX_* layout flags
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED_NeoMatrix.h>
+
+// Maps display coordinates to LED index in the strip, for a panel of W x H LEDs, or for
+// TX x TY such panels chained as per NEO_TILE_* flags of the layout, the same way as
+// FastLED_NeoMatrix tiles them.
+// The table lives in flash, lookup is a plain array read instead of per pixel
+// layout arithmetic done by FastLED_NeoMatrix.
+template <uint16_t W, uint16_t H, uint8_t Layout, uint8_t TX = 1, uint8_t TY = 1>
+struct XYMap {
+    static constexpr uint16_t width = W * TX;
+    static constexpr uint16_t height = H * TY;
+    static constexpr uint16_t size = width * height;
+
+    // Within a single panel, entered at the corner given
+    static constexpr uint16_t panelIndex(uint16_t x, uint16_t y, uint8_t corner) {
+        if (corner & NEO_MATRIX_RIGHT) x = W - 1 - x;
+        if (corner & NEO_MATRIX_BOTTOM) y = H - 1 - y;
+        if ((Layout & NEO_MATRIX_AXIS) == NEO_MATRIX_ROWS) {
+            if ((Layout & NEO_MATRIX_SEQUENCE) == NEO_MATRIX_ZIGZAG && (y & 1)) x = W - 1 - x;
+            return y * W + x;
+        } else {
+            if ((Layout & NEO_MATRIX_SEQUENCE) == NEO_MATRIX_ZIGZAG && (x & 1)) y = H - 1 - y;
+            return x * H + y;
+        }
+    }
+
+    static constexpr uint16_t index(uint16_t x, uint16_t y) {
+        uint8_t corner = Layout & NEO_MATRIX_CORNER;
+        uint16_t tile = 0;
+        if (TX * TY > 1) {
+            uint16_t minor = x / W, major = y / H;
+            x -= minor * W;
+            y -= major * H;
+            if (Layout & NEO_TILE_RIGHT) minor = TX - 1 - minor;
+            if (Layout & NEO_TILE_BOTTOM) major = TY - 1 - major;
+            uint16_t majorScale = TX;
+            if ((Layout & NEO_TILE_AXIS) == NEO_TILE_COLUMNS) {
+                uint16_t t = major;
+                major = minor;
+                minor = t;
+                majorScale = TY;
+            }
+            if ((Layout & NEO_TILE_SEQUENCE) == NEO_TILE_ZIGZAG && (major & 1)) {
+                corner ^= NEO_MATRIX_CORNER;    // panels of the odd rows turned upside down
+                tile = (major + 1) * majorScale - 1 - minor;
+            } else {
+                tile = major * majorScale + minor;
+            }
+        }
+        return tile * W * H + panelIndex(x, y, corner);
+    }
+
+    struct Table {
+        uint16_t xy[size];
+    };
+
+    static constexpr Table build() {
+        Table t = {};
+        for (uint16_t y = 0; y < height; y++) {
+            for (uint16_t x = 0; x < width; x++) {
+                t.xy[y * width + x] = index(x, y);
+            }
+        }
+        return t;
+    }
+
+    static constexpr Table table = build();
+};
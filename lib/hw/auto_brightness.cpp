@@ -0,0 +1,57 @@
+// Class AutoBrightness - display brightness following the ambient light sensor
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "auto_brightness.h"
+
+void AutoBrightness::begin(uint32_t now) {
+    uint16_t sample = _min((uint16_t) analogRead(pin_), (uint16_t) AUTO_BRIGHTNESS_SENSOR_MAX);
+    average_ = (uint32_t) sample << AUTO_BRIGHTNESS_FILTER_SHIFT;
+    anchor_ = sample;
+    target_ = brightness_ = curve(sample);
+    lastSample_ = now;
+}
+
+bool AutoBrightness::update(uint32_t now) {
+    if (now - lastSample_ < AUTO_BRIGHTNESS_SAMPLE_INTERVAL) {
+        return false;
+    }
+    lastSample_ = now;
+    uint16_t sample = _min((uint16_t) analogRead(pin_), (uint16_t) AUTO_BRIGHTNESS_SENSOR_MAX);
+    average_ -= average_ >> AUTO_BRIGHTNESS_FILTER_SHIFT;
+    average_ += sample;
+
+    uint16_t current = level();
+    uint16_t distance = (current > anchor_) ? current - anchor_ : anchor_ - current;
+    // the ends of the range are reached even when closer than the hysteresis
+    bool atEnd = current != anchor_ && (current == 0 || current == AUTO_BRIGHTNESS_SENSOR_MAX);
+    if (distance > AUTO_BRIGHTNESS_HYSTERESIS || atEnd) {
+        anchor_ = current;
+        target_ = curve(current);
+    }
+
+    if (brightness_ == target_) {
+        return false;
+    }
+    if (brightness_ < target_) {
+        brightness_ = _min((int) target_, brightness_ + AUTO_BRIGHTNESS_STEP);
+    } else {
+        brightness_ = _max((int) target_, brightness_ - AUTO_BRIGHTNESS_STEP);
+    }
+    return true;
+}
+
+uint8_t AutoBrightness::curve(uint16_t level) const {
+    float perceived = (float) level / AUTO_BRIGHTNESS_SENSOR_MAX;
+    return min_ + (uint8_t) ((max_ - min_) * powf(perceived, AUTO_BRIGHTNESS_GAMMA) + 0.5f);
+}
+
+uint16_t AutoBrightness::estimateMilliamps(const CRGB *leds, uint16_t count, uint8_t brightness, uint32_t budgetMw) {
+    uint32_t unscaled = calculate_unscaled_power_mW(leds, count);
+    if (budgetMw > 0) {
+        brightness = calculate_max_brightness_for_power_mW(leds, count, brightness, budgetMw);
+    }
+    uint32_t idle = (uint32_t) AUTO_BRIGHTNESS_LED_IDLE_MW * count;
+    uint32_t lit = (unscaled > idle) ? unscaled - idle : 0;
+    return (idle + ((lit * brightness) >> 8)) / AUTO_BRIGHTNESS_LED_VOLTS;
+}
@@ -0,0 +1,53 @@
+// Class AutoBrightness - display brightness following the ambient light sensor
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#define AUTO_BRIGHTNESS_SAMPLE_INTERVAL 50  // milliseconds between sensor samples
+#define AUTO_BRIGHTNESS_FILTER_SHIFT 4      // weight of a new sample in the average, 1 / 2^shift
+#define AUTO_BRIGHTNESS_HYSTERESIS 64       // sensor counts the level has to move by to change the target
+#define AUTO_BRIGHTNESS_STEP 2              // brightness change per sample, fades instead of jumping
+#define AUTO_BRIGHTNESS_GAMMA 2.2f
+#define AUTO_BRIGHTNESS_SENSOR_MAX 4095     // 12-bit ADC, the more light the higher
+#define AUTO_BRIGHTNESS_LED_VOLTS 5
+#define AUTO_BRIGHTNESS_LED_IDLE_MW 5       // dark LED, 1 mA at 5 V, as in FastLED power model
+
+// The sensor is sampled every AUTO_BRIGHTNESS_SAMPLE_INTERVAL into an exponential moving
+// average, flicker and people passing by the clock get smoothed out. The target brightness
+// is set anew only once the average moves away by more than the hysteresis from where it
+// was last set, so a level around a boundary does not make the display waver. The level is
+// taken as the perceived brightness wanted and mapped to the (linear) LED duty through the
+// gamma curve, most of the sensor range thus goes to the dim end. The brightness then fades
+// to the target by AUTO_BRIGHTNESS_STEP per sample.
+class AutoBrightness {
+public:
+    AutoBrightness(uint8_t pin, uint8_t minBrightness, uint8_t maxBrightness) : pin_(pin), min_(minBrightness), max_(maxBrightness), brightness_(maxBrightness), target_(maxBrightness) {};
+
+    // First sample seeds the average, brightness is set to its target at once
+    void begin(uint32_t now);
+
+    // Samples the sensor when due, true if the brightness has changed
+    bool update(uint32_t now);
+
+    inline uint8_t brightness() const { return brightness_; }
+    inline uint8_t target() const { return target_; }
+    inline uint16_t level() const { return average_ >> AUTO_BRIGHTNESS_FILTER_SHIFT; }
+
+    // Current drawn by the LEDs showing the pixels at the brightness given, in mA, by the
+    // FastLED power model, with the brightness limited to the power budget (as FastLED
+    // does when showing them), budgetMw 0 for no limit.
+    static uint16_t estimateMilliamps(const CRGB *leds, uint16_t count, uint8_t brightness, uint32_t budgetMw = 0);
+
+private:
+    uint8_t pin_, min_, max_;
+    uint8_t brightness_, target_;
+    uint32_t average_ = 0;      // level << AUTO_BRIGHTNESS_FILTER_SHIFT
+    uint16_t anchor_ = 0;       // level the target has been set at
+    uint32_t lastSample_ = 0;
+
+    uint8_t curve(uint16_t level) const;
+};
@@ -6,4 +6,30 @@
 #include "hw.h"
 
 volatile DisplayState Hw::displayState = DISPLAY_BOOT;
-volatile bool Hw::enforceUpdate = false;
\ No newline at end of file
+volatile bool Hw::enforceUpdate = false;
+volatile uint32_t Hw::tickPhaseErrorUs = 0;
+volatile uint32_t Hw::tickPhaseErrorMaxUs = 0;
+volatile uint16_t Hw::displayCurrentMa = 0;
+volatile uint16_t Hw::displayFullCurrentMa = 0;
+
+bool Hw::secondTick(time_t& lastSecond, struct timeval& now) {
+    gettimeofday(&now, nullptr);
+    if (now.tv_sec == lastSecond) {
+        return false;
+    }
+    if (lastSecond != 0 && now.tv_sec == lastSecond + 1) {
+        // regular tick; not a forced one, nor a clock step (NTP sync, RTC correction)
+        tickPhaseErrorUs = now.tv_usec;
+        if (now.tv_usec > tickPhaseErrorMaxUs) {
+            tickPhaseErrorMaxUs = now.tv_usec;
+        }
+    }
+    lastSecond = now.tv_sec;
+    return true;
+}
+
+uint32_t Hw::msToNextSecond() {
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    return (1000000UL - now.tv_usec + 999) / 1000;
+}
\ No newline at end of file
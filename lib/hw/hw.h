@@ -6,6 +6,7 @@
 #pragma once
 
 #include "bcpevent.h"
+#include <sys/time.h>
 
 enum DisplayState {
     DISPLAY_BOOT,
@@ -29,7 +30,21 @@ public:
 
     virtual void tick() {};
 
+    // How late after the wall-clock second boundary the countdown was last updated, and the worst
+    // case seen since reset by the reader
+    static volatile uint32_t tickPhaseErrorUs;
+    static volatile uint32_t tickPhaseErrorMaxUs;
+
+    // Estimated current drawn by the display (refreshed once a second), and what it would be at full brightness
+    static volatile uint16_t displayCurrentMa;
+    static volatile uint16_t displayFullCurrentMa;
+
     virtual void configServerMsg(const char *msg) = 0;
 
     virtual void reboot() = 0;
+
+protected:
+    // True on the first call after each wall-clock second boundary, lastSecond = 0 forces a tick
+    static bool secondTick(time_t& lastSecond, struct timeval& now);
+    static uint32_t msToNextSecond();
 };
\ No newline at end of file
@@ -0,0 +1,366 @@
+// Class Screens - what the clock shows, drawn into layers composed to LEDs
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include "screens.h"
+
+#include <f3x5.h>
+#include <f4x6.h>
+
+static CRGB palette[COLOR_COUNT] = {
+    CRGB::Black,        // COLOR_BLACK
+    CRGB::White,        // COLOR_WHITE
+    CRGB::Red,          // COLOR_RED
+    CRGB::Yellow,       // COLOR_YELLOW
+    CRGB::Green,        // COLOR_GREEN
+    CRGB::Magenta,      // COLOR_MAGENTA
+    CRGB::DeepSkyBlue,  // COLOR_DEEPSKYBLUE
+    CRGB(20, 20, 20)    // COLOR_DARKGRAY
+};
+
+static const UTF8_32BitFont *defaultFont = &F3x5[0];
+
+Screens::Screens(CRGB *leds, const uint16_t *xyMap) :
+        backgroundLayer_(width, height), textLayer_(width, height), statusLayer_(width, height), overlayLayer_(width, height),
+        compositor_(leds, xyMap, width, height), countdownDigits_(&textLayer_) {
+}
+
+// The animator deletes what it owns, the event name strip is released to be deleted here
+Screens::~Screens() {
+    stopAnimations();
+    delete eventNameText_;
+}
+
+void Screens::begin(Print *debugOut) {
+    debugOut_ = debugOut;
+
+    // layers from bottom to top
+    backgroundLayer_.setOpaqueArea(0, 0, width, height);
+    compositor_.addLayer(&backgroundLayer_);
+    textLayer_.setTextWrap(false);
+    textLayer_.setTextColor(COLOR_WHITE);
+    textLayer_.setFont((GFXfont *) defaultFont);
+    compositor_.addLayer(&textLayer_);
+    compositor_.addLayer(&statusLayer_);
+    overlayLayer_.setOpaqueArea(0, 0, width, height);
+    overlayLayer_.setVisible(false);
+    compositor_.addLayer(&overlayLayer_);
+    compositor_.addEffect(&effect_);
+
+    // sprites are global to all text drawn, set up once for all the instances
+    static bool spritesAdded = false;
+    if (!spritesAdded) {
+        for (uint8_t i = 0; i < EmojiAtlas.paletteSize; i++) {
+            const uint8_t *rgb = EmojiAtlas.palette + 3 * i;
+            palette[COLOR_SPRITES + i] = CRGB(pgm_read_byte(&rgb[0]), pgm_read_byte(&rgb[1]), pgm_read_byte(&rgb[2]));
+        }
+        Sprites::add(&EmojiAtlas, COLOR_SPRITES);
+        GraphemeComposer::setFlags(&EmojiFlags);
+        spritesAdded = true;
+    }
+    compositor_.setPalette(palette, COLOR_COUNT);
+}
+
+void Screens::stopAnimations() {
+    if (scrollingText_) {
+        scrollingText_->isActive = false;
+        logDroppedFrames("scrolling text", scrollingText_);
+        if (scrollingText_ == eventNameText_) {
+            animator_.release(scrollingText_); // kept, to continue where it stopped next time
+        } else {
+            animator_.remove(scrollingText_);
+        }
+        scrollingText_ = nullptr;
+    }
+    progressStop();
+}
+
+// The animator owns the animation from now on, remove it through the animator.
+void Screens::animate(GFXanimation *animation, uint16_t intervalMs) {
+    animation->setInterval(intervalMs);
+    if (!animator_.add(animation, millis())) {
+        debugPrintln("Too many animations, not animated");
+    }
+}
+
+void Screens::logDroppedFrames(const char *name, const GFXanimation *animation) {
+    if (animation->droppedFrames() > 0) {
+        debugPrintln(String(name) + " dropped " + String(animation->droppedFrames()) + " of " + String(animation->frames()) + " frames");
+    }
+}
+
+// Logs usage of all memory pools, unless always, only when some pool ran out since last time.
+void Screens::logPoolStats(bool always) {
+    static uint32_t lastExhausted = 0;
+    uint32_t exhausted = 0;
+    for (const MemoryPool *pool = MemoryPool::first(); pool != nullptr; pool = pool->next()) {
+        exhausted += pool->exhausted();
+    }
+    if (!always && exhausted == lastExhausted) {
+        return;
+    }
+    lastExhausted = exhausted;
+    for (const MemoryPool *pool = MemoryPool::first(); pool != nullptr; pool = pool->next()) {
+        debugPrintln(String(pool->name()) + " pool: " + String(pool->inUse()) + " of " + String(pool->capacity()) + " in use, high water " + String(pool->highWater()) + ", exhausted " + String(pool->exhausted()) + "x");
+    }
+}
+
+void Screens::clearScreen() {
+    stopAnimations();
+    logPoolStats();
+    tickSecond = 0; // countdown, if any, redrawn on the next frame
+    countdownDigits_.reset();
+    if (effect_.type() != EFFECT_NONE) {
+        setEffect(EFFECT_NONE);
+    }
+    textLayer_.fillScreen(COLOR_BLACK);
+    statusLayer_.fillScreen(COLOR_BLACK);
+}
+
+// Overlay shows a message over the current screen, which keeps being updated beneath.
+// Overlay hides itself once the message has scrolled through.
+void Screens::showOverlayMsg(const char *msg, uint16_t color) {
+    hideOverlay();
+    overlayLayer_.fillScreen(COLOR_BLACK);
+    overlayText_ = new ScrollingText(&overlayLayer_, msg, 0, top + 7, (const GFXfont *) defaultFont, false, color, width - 8, 8, false);
+    animate(overlayText_, SCROLLING_TEXT_SPEED);
+    overlayLayer_.setVisible(true);
+}
+
+void Screens::hideOverlay() {
+    if (overlayText_) {
+        logDroppedFrames("overlay text", overlayText_);
+        animator_.remove(overlayText_);
+        overlayText_ = nullptr;
+    }
+    overlayLayer_.setVisible(false);
+}
+
+// Countdown layouts of the 32 pixels wide display as they were hand placed, 10+ hours are new
+static_assert(CountdownLayout<32>::text(false, 0).font == &F4x6 && CountdownLayout<32>::text(false, 0).x == 5, "mm:ss layout");
+static_assert(CountdownLayout<32>::text(true, 0).font == &F4x6 && CountdownLayout<32>::text(true, 0).x == 1, "-mm:ss layout");
+static_assert(CountdownLayout<32>::text(false, 1).font == &F3x5_Fixed && CountdownLayout<32>::text(false, 1).x == 3, "h:mm:ss layout");
+static_assert(CountdownLayout<32>::text(true, 1).font == &F3x5_Fixed && CountdownLayout<32>::text(true, 1).x == -1, "-h:mm:ss layout");
+static_assert(CountdownLayout<32>::text(false, 2).fits && !CountdownLayout<32>::text(true, 2).fits, "hh:mm:ss layouts");
+
+void Screens::setEffect(EffectType type, bool textOnly, int16_t x, int16_t y, int16_t w, int16_t h) {
+    effect_.set(type);
+    effect_.setTarget(textOnly ? &textLayer_ : nullptr);
+    effect_.setClip(x, y, w, h);
+    compositor_.invalidate(); // the previous clip area, if any, loses the effect
+}
+
+void Screens::showSplashScreen(bool showProgress) {
+    clearScreen();
+    int y = top + (showProgress ? 6 : 7);
+    textLayer_.setCursor(0, y);
+    textLayer_.setTextColor(COLOR_WHITE);
+    textLayer_.print("BCP");
+    int16_t x1, y1;
+    uint16_t w, h;
+    LayoutCache::getTextBounds("clock", (const GFXfont *) defaultFont, false, false, 0, y, &x1, &y1, &w, &h);
+    textLayer_.setCursor((textLayer_.width() - w), y);
+    textLayer_.print("clock");
+    if (showProgress) {
+        progressStart();
+    }
+}
+
+void Screens::showConfigServerMsg(const char *msg, bool loop) {
+    if (loop) {
+        clearScreen();
+        scrollingText_ = new ScrollingText(&textLayer_, msg, 0, top + 7, (const GFXfont *) defaultFont, false, COLOR_WHITE, width - 8, 8, loop);
+        animate(scrollingText_, SCROLLING_TEXT_SPEED);
+    } else {
+        showOverlayMsg(msg, COLOR_WHITE);
+    }
+}
+
+void Screens::showRoundWithCountdown(int currentRound, int totalRounds) {
+    uint16_t activeColor = COLOR_DEEPSKYBLUE,
+             inactiveColor = COLOR_DARKGRAY;
+    const int line = top + 7;
+    statusLayer_.drawFastHLine(0, line, statusLayer_.width(), COLOR_BLACK);
+    const CountdownLayoutTable::Bar &bar = CountdownLayoutTable::bar(totalRounds);
+    if (bar.pitch > 1) {
+        for (int i = 0; i < totalRounds; i++) {
+            statusLayer_.drawFastHLine(i * bar.pitch + bar.offset, line, bar.width, (i == currentRound - 1) ? activeColor : inactiveColor);
+        }
+    } else if (bar.pitch == 1) {
+        int t = _min(totalRounds, (int) statusLayer_.width()), start = bar.offset;
+        for (int i = 0; i < t; i++) {
+            if (bar.gaps && (i == currentRound - 1 || i == currentRound)) {
+                start++;
+            }
+            statusLayer_.drawPixel(start + i, line, (i == currentRound - 1) ? activeColor : inactiveColor);
+        }
+    }
+}
+
+// The strip of the name is kept while the screens flip, shown again it just continues
+// scrolling from where it stopped.
+void Screens::showEventName(const char *name) {
+    clearScreen();
+    if (eventNameText_ == nullptr || eventNameShown_ != name) {
+        delete eventNameText_;
+        eventNameText_ = new ScrollingText(&textLayer_, name, 0, top + 7, defaultFont, true, COLOR_WHITE, width);
+        eventNameShown_ = name;
+    } else {
+        eventNameText_->isActive = true;
+        eventNameText_->draw();
+    }
+    scrollingText_ = eventNameText_;
+    animate(scrollingText_, SCROLLING_TEXT_SPEED);
+}
+
+void Screens::showEventRound(int round) {
+    clearScreen();
+    textLayer_.setTextColor(COLOR_WHITE);
+    int16_t  x1, y1;
+    uint16_t w, h;
+    String msg = "Round " + String(round);
+    LayoutCache::getTextBounds(msg.c_str(), (const GFXfont *) defaultFont, false, false, 0, top + 7, &x1, &y1, &w, &h);
+    textLayer_.setCursor((textLayer_.width() - w) / 2, top + 7);
+    textLayer_.print(msg);
+}
+
+void Screens::showCountdown(const CBCPEvent& event, time_t now) {
+    long remaining = event.timerPaused() ? (long) event.pausedTimeRemaining() : (long) (event.roundEndEpoch() - now);
+    showCountdown(remaining, event.timerLength(), event.timerPaused(), event.currentRound(), event.numberOfRounds(), now);
+}
+
+void Screens::showCountdown(long remaining, uint32_t timerLength, bool paused, int currentRound, int totalRounds, time_t now) {
+    stopAnimations();
+    bool dontDisplayHours = timerLength <= 3600;
+    uint16_t color;
+
+    if (paused) {
+        // timer is paused
+        color = now % 2 ? COLOR_MAGENTA : COLOR_BLACK;
+    } else if (remaining <= red_) {
+        // we are below red threshold of the timer
+        color = COLOR_RED;
+    } else if (remaining <= yellow_) {
+        // we are below yellow threshold of the timer
+        color = COLOR_YELLOW;
+    } else if (remaining > (long) timerLength || (remaining == (long) timerLength && timerLength <= 3600)) {
+        // event round not yet started, show time to start
+        color = COLOR_GREEN;
+        remaining -= timerLength;
+        dontDisplayHours = remaining < 3600 && timerLength <= 3600;
+    } else {
+        color = COLOR_WHITE;
+    }
+
+    String out  = remaining < 0 ? "-" : "";
+    int absoluteTime = remaining < 0 ? -remaining : remaining;
+    int hours = absoluteTime / 3600;
+    int minutes = (absoluteTime % 3600) / 60;
+    int seconds = absoluteTime % 60;
+
+    // font and position by sign and hour digits, from the table solved at compile time
+    const CountdownLayoutTable::Text *layout = &CountdownLayoutTable::text(remaining < 0, dontDisplayHours ? 0 : (hours >= 10 ? 2 : 1));
+    if (dontDisplayHours) {
+        // mm:ss
+        if (remaining < -3599) {
+            out = "-//://";    // To save space in the font, X bitmap mapped to / character
+        } else {
+            out += String(minutes / 10) + String(minutes % 10) + ":" +
+                   String(seconds / 10) + String(seconds % 10);
+        }
+    } else if (!layout->fits) {
+        // too many hours over time to fit
+        layout = &CountdownLayoutTable::text(true, 1);
+        out = "-/://://";  // To save space in the font, X bitmap mapped to / character
+    } else {
+        // h:mm:ss, hh:mm:ss
+        out += String(hours) + ":" +
+            String(minutes / 10) + String(minutes % 10) + ":" +
+            String(seconds / 10) + String(seconds % 10);
+    }
+    const GFXfont *font = layout->font;
+    int x = layout->x;
+
+    // only the digits changed roll in, while the layout stays; drawn whole otherwise
+    if (!countdownDigits_.roll(out.c_str(), font, x, top + 6, color, millis())) {
+        textLayer_.fillScreen(COLOR_BLACK);
+        textLayer_.setFont(font);
+        textLayer_.setTextColor(color);
+        textLayer_.setCursor(x, top + 6);
+        textLayer_.print(out);
+    }
+    showRoundWithCountdown(currentRound, totalRounds);
+    textLayer_.setFont((GFXfont *) defaultFont);
+
+    // over time the countdown gets its effect, if any, until back in time or another screen is shown
+    EffectType effect = (!paused && remaining < 0) ? overtimeEffect_ : EFFECT_NONE;
+    if (effect_.type() != effect) {
+        setEffect(effect);
+    }
+}
+
+void Screens::progressStart() {
+    if (progressIndicator_ == nullptr) {
+        progressIndicator_ = new ProgressIndicator(&statusLayer_, -1, top + 7, statusLayer_.width(), COLOR_WHITE, COLOR_BLACK);
+        animate(progressIndicator_, PROGRESS_INDICATOR_SPEED);
+    }
+    progressIndicator_->isActive = true;
+    animator_.restart(progressIndicator_, millis());
+}
+
+void Screens::progressStop() {
+    if (progressIndicator_ != nullptr && progressIndicator_->isActive) {
+        progressIndicator_->hide();
+        progressIndicator_->isActive = false;
+    }
+}
+
+void Screens::showPrintLine(const char *line) {
+    if (strncmp(line, "Error:", 6) == 0) {
+        // Error message, display in red
+        clearScreen();
+        scrollingText_ = new ScrollingText(&textLayer_, line, 0, top + 7, (const GFXfont *) defaultFont, false, COLOR_RED, width);
+        animate(scrollingText_, SCROLLING_TEXT_SPEED);
+        if (initMsg_.length() > 0) {
+            scrollingText_->append(initMsg_, COLOR_WHITE, true, width);
+        } else {
+            errorShown_ = true;
+        }
+
+    } else if (strncmp(line, "Connecting ", 11) == 0) {
+        // Connecting message, show progress indicator
+        clearScreen();
+        textLayer_.setCursor(2 + (width - 32) / 2, top + 6);
+        textLayer_.setTextColor(COLOR_WHITE);
+        textLayer_.print("Connect");
+        progressStart();
+
+    } else if (strncmp(line, "Connected ", 10) == 0) {
+        // do nothing, let the current status message continue
+
+    } else {
+        if (errorShown_ && scrollingText_ != nullptr) {
+            scrollingText_->append(line, COLOR_WHITE, true, width);
+            errorShown_ = false;
+        } else {
+            clearScreen();
+            scrollingText_ = new ScrollingText(&textLayer_, line, 0, top + 7, (const GFXfont *) defaultFont, false, COLOR_WHITE, width);
+            animate(scrollingText_, SCROLLING_TEXT_SPEED);
+        }
+        if (initMsg_.length() == 0) initMsg_ = String(line);
+    }
+}
+
+// ---- Render loop ----
+
+bool Screens::frame(uint32_t now) {
+    if (overlayText_ && !overlayText_->isActive) {
+        hideOverlay();
+    }
+
+    // animations keep their pace from their start, frames missed by a stall are dropped
+    animator_.update(now);
+    countdownDigits_.update(now);
+
+    return compositor_.compose(now);
+}
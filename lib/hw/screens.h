@@ -0,0 +1,143 @@
+// Class Screens - what the clock shows, drawn into layers composed to LEDs
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#include <progress_indicator.h>
+#include <animator.h>
+#include <scrolling_text.h>
+#include <digit_roll.h>
+#include <countdown_layout.h>
+#include <layout_cache.h>
+#include <layer.h>
+#include <compositor.h>
+#include <effect.h>
+#include <bcpevent.h>
+
+// Display geometry, the TC001 built-in 32x8 matrix by default. Other panels, or several
+// chained (see XYMap), are selected by build flags, see platformio.ini.
+#ifndef TC001_PANEL_WIDTH
+#define TC001_PANEL_WIDTH 32
+#endif
+#ifndef TC001_PANEL_HEIGHT
+#define TC001_PANEL_HEIGHT 8
+#endif
+#ifndef TC001_PANELS_X
+#define TC001_PANELS_X 1
+#endif
+#ifndef TC001_PANELS_Y
+#define TC001_PANELS_Y 1
+#endif
+
+// Effect of the countdown while the round runs over time, none by default;
+// e.g. -DSCREENS_OVERTIME_EFFECT=EFFECT_PULSE
+#ifndef SCREENS_OVERTIME_EFFECT
+#define SCREENS_OVERTIME_EFFECT EFFECT_NONE
+#endif
+
+#define SCROLLING_TEXT_SPEED 100 // milliseconds per step
+#define PROGRESS_INDICATOR_SPEED 100 // milliseconds per step
+
+// Colors drawn into layers are indices into the palette,
+// resolved to CRGB by the compositor when blitting to the LEDs
+enum PaletteColor : uint16_t {
+    COLOR_BLACK = 0,    // transparent in layers, keep it 0
+    COLOR_WHITE,
+    COLOR_RED,
+    COLOR_YELLOW,
+    COLOR_GREEN,
+    COLOR_MAGENTA,
+    COLOR_DEEPSKYBLUE,
+    COLOR_DARKGRAY,
+    COLOR_SPRITES,      // sprite atlas colors follow, filled in from the atlas palette
+    COLOR_COUNT = COLOR_SPRITES + SPRITES_MAX_COLORS
+};
+
+// All the screens of the clock, independent of the hardware: the backend (Tc001 on the
+// device, Emulator_hw on the host) hands over the LEDs and their XY map, runs the show*()
+// methods from its render task only, and calls frame() from its render loop. Starts of
+// the animations are taken from millis().
+class Screens {
+public:
+    static constexpr int16_t width = TC001_PANEL_WIDTH * TC001_PANELS_X;
+    static constexpr int16_t height = TC001_PANEL_HEIGHT * TC001_PANELS_Y;
+
+    Screens(CRGB *leds, const uint16_t *xyMap);
+    ~Screens();
+    void begin(Print *debugOut = nullptr);    // layers stacked, palette and sprites set up
+
+    // ---- Screens ----
+    void showSplashScreen(bool showProgress);
+    void showEventName(const char *name);
+    void showEventRound(int round);
+    void showConfigServerMsg(const char *msg, bool loop);   // over the current screen unless loop
+    void showPrintLine(const char *line);                   // status lines of the boot
+
+    // remaining seconds of the round (or of the pause), now only blinks the paused timer
+    void showCountdown(long remaining, uint32_t timerLength, bool paused, int currentRound, int totalRounds, time_t now);
+    void showCountdown(const CBCPEvent& event, time_t now);
+    void setThresholds(long yellow, long red) { yellow_ = yellow; red_ = red; }
+    void setOvertimeEffect(EffectType type) { overtimeEffect_ = type; }
+    void showRoundWithCountdown(int currentRound, int totalRounds);  // round bar beneath the countdown
+
+    // Color effect over the clip area, on text pixels only or on all; EFFECT_NONE turns it off
+    void setEffect(EffectType type, bool textOnly = true, int16_t x = 0, int16_t y = 0, int16_t w = width, int16_t h = height);
+
+    // Second of the countdown shown, 0 once the screen is cleared, for the countdown to be redrawn
+    time_t tickSecond = 0;
+
+    // ---- Render loop ----
+    // Animations and rolls moved to the time given, then composed into the LEDs,
+    // returns true if any LED changed
+    bool frame(uint32_t now);
+
+private:
+    // Screens are laid out for 8 rows, on taller displays centered vertically
+    static constexpr int16_t top = (height - 8) / 2;
+    // Wider displays need a larger -DSCROLLING_TEXT_WINDOW_PIXELS (see platformio.ini), windows would go to the heap
+    static_assert(width * SCROLLING_TEXT_BAND_HEIGHT <= SCROLLING_TEXT_WINDOW_PIXELS, "scrolling text window pool too small for the display width");
+    typedef CountdownLayout<width> CountdownLayoutTable;
+
+    Print *debugOut_ = nullptr;
+    void debugPrintln(const String& msg) {
+        if (debugOut_ != nullptr) {
+            debugOut_->println("[Screens] " + msg);
+        }
+    }
+
+    long yellow_ = 600, red_ = 0;  // seconds, defaults of the config page
+    EffectType overtimeEffect_ = SCREENS_OVERTIME_EFFECT;
+
+    // ---- Layers, from bottom to top ----
+    Layer backgroundLayer_;
+    Layer textLayer_;       // countdown, event name, round, status messages
+    Layer statusLayer_;     // round bar, progress indicator
+    Layer overlayLayer_;    // transient messages over the current screen
+    Compositor compositor_;
+    Effect effect_;
+
+    // ---- Animations, owned by the animator ----
+    Animator animator_;
+    ProgressIndicator *progressIndicator_ = nullptr;
+    ScrollingText *scrollingText_ = nullptr;
+    ScrollingText *overlayText_ = nullptr;
+    ScrollingText *eventNameText_ = nullptr;    // not owned by the animator, kept across screens until the name changes
+    String eventNameShown_;
+    DigitRoll countdownDigits_;     // countdown on the text layer, changed digits rolled in
+    void stopAnimations();
+    void animate(GFXanimation *animation, uint16_t intervalMs);
+    void logDroppedFrames(const char *name, const GFXanimation *animation);
+    void logPoolStats(bool always = false);
+    void clearScreen();
+    void showOverlayMsg(const char *msg, uint16_t color);
+    void hideOverlay();
+    void progressStart();
+    void progressStop();
+
+    String initMsg_;
+    bool errorShown_ = false;
+};
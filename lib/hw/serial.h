@@ -66,8 +66,8 @@ public:
         Serial.println("Round " + String(event.currentRound()));
     }
 
-    static void displayCountdown(const CBCPEvent& event) {
-        long remaining = event.roundEndEpoch() - time(nullptr);
+    static void displayCountdown(const CBCPEvent& event, time_t now) {
+        long remaining = event.roundEndEpoch() - now;
         String out  = remaining < 0 ? "-" : "";
         int absoluteTime = remaining < 0 ? -remaining : remaining;
         int hours = absoluteTime / 3600;
@@ -98,10 +98,10 @@ public:
     }
 
     virtual void tick() override {
-        static unsigned long lMillis = 0;
-        if (displayState == DISPLAY_EVENT_COUNTDOWN && (lMillis == 0 || millis() - lMillis > 1000)) {
-            lMillis = (lMillis == 0) ? millis() : lMillis + 1000;
-            displayCountdown(BCPEvent);
+        static time_t tickSecond = 0;
+        struct timeval now;
+        if (displayState == DISPLAY_EVENT_COUNTDOWN && secondTick(tickSecond, now)) {
+            displayCountdown(BCPEvent, now.tv_sec);
         }
     }
 
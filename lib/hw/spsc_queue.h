@@ -0,0 +1,47 @@
+// Lock-free single producer / single consumer ring buffer
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+
+// Exactly one task may call push() and exactly one (other) task may call pop().
+// Items are copied in and out, so keep T a plain struct without heap ownership.
+template <typename T, size_t N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    // ---- Producer side ----
+    bool push(const T& item) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) >= N) {
+            return false; // full
+        }
+        items_[head & (N - 1)] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // ---- Consumer side ----
+    bool pop(T& item) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) {
+            return false; // empty
+        }
+        item = items_[tail & (N - 1)];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+    }
+
+private:
+    T items_[N];
+    std::atomic<size_t> head_{0};   // next slot to write, owned by producer
+    std::atomic<size_t> tail_{0};   // next slot to read, owned by consumer
+};
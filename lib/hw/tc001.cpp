@@ -4,8 +4,6 @@
 
 #include "tc001.h"
 
-#include <f3x5.h>
-#include <f4x6.h>
 #include <wifimgr.h>
 #include <config.h>
 #include <bcpevent.h>
@@ -14,49 +12,35 @@
 #define PIN_MID_BUTTON      27
 #define PIN_RIGHT_BUTTON    14
 #define PIN_LED_MATRIX      32
-
-#define COLOR_WHITE matrix.Color24to16(CRGB::White)
-#define COLOR_BLACK matrix.Color24to16(CRGB::Black)
-#define COLOR_RED matrix.Color24to16(CRGB::Red)
-#define COLOR_YELLOW matrix.Color24to16(CRGB::Yellow)
-#define COLOR_GREEN matrix.Color24to16(CRGB::Green)
-#define COLOR_MAGENTA matrix.Color24to16(CRGB::Magenta)
-#define COLOR_DEEPSKYBLUE matrix.Color24to16(CRGB::DeepSkyBlue)
-#define COLOR_DARKGRAY matrix.Color(20, 20, 20)
-
-#define SCROLLING_TEXT_SPEED 100 // miliseconds per step
-#define PROGRESS_INDICATOR_SPEED 100 // milliseconds per step
+#define PIN_LIGHT_SENSOR    35
 
 constexpr int DEBOUNCE_DELAY_MS = 500;
+constexpr uint32_t CURRENT_ESTIMATE_INTERVAL_MS = 1000;
 
-CRGB Tc001::matrixleds[256];
-FastLED_NeoMatrix Tc001::matrix = FastLED_NeoMatrix(Tc001::matrixleds, 32, 8, NEO_MATRIX_TOP + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS + NEO_MATRIX_ZIGZAG);
-
-const UTF8_32BitFont* Tc001::defaultFont = &F3x5[0];
-const GFXfont* Tc001::hmmssFont = &F3x5_Fixed;
-const GFXfont* Tc001::mmssFont = &F4x6;
+CRGB Tc001::matrixleds[Tc001::MatrixXY::size];
 
-unsigned long Tc001::stMillis = 0;
-unsigned long Tc001::piMillis = 0;
-unsigned long Tc001::lMillis = 0;
+Screens Tc001::screens(Tc001::matrixleds, Tc001::MatrixXY::table.xy);
+AutoBrightness Tc001::autoBrightness(PIN_LIGHT_SENSOR, TC001_BRIGHTNESS_MIN, TC001_BRIGHTNESS_MAX);
 
-ProgressIndicator* Tc001::progressIndicator = nullptr;
-ScrollingText* Tc001::scrollingText = nullptr;
 bool Tc001::midButtonPressed = false;
 
+SpscQueue<Tc001::DisplayCommand, 8> Tc001::commands;
+TaskHandle_t Tc001::eventHandlerTask = nullptr;
+
 Tc001::Tc001(Print *debugOut) : debugOut_(debugOut) {
     pinMode(PIN_BUZZER, INPUT_PULLDOWN);      // stop whistle noise
     pinMode(PIN_MID_BUTTON, INPUT_PULLUP);    // mid button
     pinMode(PIN_RIGHT_BUTTON, INPUT_PULLUP);  // right button
+    pinMode(PIN_LIGHT_SENSOR, INPUT);         // ambient light sensor
     Serial.begin(9600);
     while (!Serial);
 
-    FastLED.addLeds<NEOPIXEL,PIN_LED_MATRIX>(matrixleds, 256);
-    matrix.begin();
-    matrix.setTextWrap(false);
-    // matrix.setBrightness(40);
-    matrix.setTextColor(matrix.Color(255, 255, 255));
-    matrix.setFont((GFXfont *) defaultFont);
+    FastLED.addLeds<NEOPIXEL,PIN_LED_MATRIX>(matrixleds, MatrixXY::size);
+    FastLED.setMaxPowerInVoltsAndMilliamps(AUTO_BRIGHTNESS_LED_VOLTS, TC001_POWER_BUDGET_MA);
+    autoBrightness.begin(millis());
+    FastLED.setBrightness(autoBrightness.brightness());
+
+    screens.begin(debugOut);
 
     xTaskCreatePinnedToCore(
             eventHandler,     // Function to run
@@ -64,202 +48,87 @@ Tc001::Tc001(Print *debugOut) : debugOut_(debugOut) {
             4096*2,           // Stack size
             NULL,             // Parameter
             1,                // Priority
-            NULL,             // Task handle
+            &eventHandlerTask, // Task handle
             1                 // Core (0 or 1)
         );
 }
 
-void Tc001::stopAnimations() {
-    if (scrollingText && scrollingText->isActive) {
-        scrollingText->isActive = false;
-        delete scrollingText;
-        scrollingText = nullptr;
+// ---- Display commands ----
+
+void Tc001::postCommand(DisplayCommandType type, int arg, const char *text) {
+    DisplayCommand cmd;
+    cmd.type = type;
+    cmd.arg = arg;
+    cmd.text[0] = '\0';
+    if (text != nullptr) {
+        strncpy(cmd.text, text, sizeof(cmd.text) - 1);
+        cmd.text[sizeof(cmd.text) - 1] = '\0';
     }
-    progressStop();
-    delay(20); // ensure any ongoing matrix updates are finished
-    stMillis = 0;
-    piMillis = 0;
-    lMillis = 0;
+    pushCommand(cmd);
 }
 
-void Tc001::splashScreen(bool showProgress) {
-    stopAnimations();
-    matrix.clear();
-    int y = showProgress ? 6 : 7;
-    matrix.setCursor(0, y);
-    matrix.setTextColor(COLOR_WHITE);
-    matrix.print("BCP");
-    int16_t x1, y1;
-    uint16_t w, h;
-    const String msg = "clock";
-    matrix.getTextBounds(msg, 0, y, &x1, &y1, &w, &h);
-    matrix.setCursor((matrix.width() - w), y);  
-    matrix.print("clock");
-    if (showProgress) {
-        progressStart();
+// Posted from the EventHandler task itself, waiting for the queue would never end:
+// the commands queued are run first, to keep the order, then the one given.
+void Tc001::pushCommand(const DisplayCommand& cmd) {
+    if (xTaskGetCurrentTaskHandle() == eventHandlerTask) {
+        DisplayCommand queued;
+        while (commands.pop(queued)) {
+            runCommand(queued);
+        }
+        runCommand(cmd);
+        return;
+    }
+    while (!commands.push(cmd)) {
+        vTaskDelay(1); // queue full, let the EventHandler task catch up
     }
-    matrix.show();
 }
 
-void Tc001::configServerMsg(const char *msg, bool loop) {
-    stopAnimations();
-    matrix.clear();
-    String msgStr = "Config page http://" + WiFi.localIP().toString();
-    scrollingText = new ScrollingText(&matrix, msgStr.c_str(), 0, 7, (const GFXfont *) defaultFont, false, COLOR_WHITE, 24, 8, loop);
-    matrix.show();
+void Tc001::runCommand(const DisplayCommand& cmd) {
+    switch (cmd.type) {
+        case CMD_SPLASH_SCREEN:
+            screens.showSplashScreen(cmd.arg != 0);
+            break;
+        case CMD_EVENT_NAME:
+            screens.showEventName(cmd.text);
+            break;
+        case CMD_EVENT_ROUND:
+            screens.showEventRound(cmd.arg);
+            break;
+        case CMD_CONFIG_SERVER_MSG:
+            showConfigServerMsg(cmd.arg != 0);
+            break;
+        case CMD_PRINT_LINE:
+            screens.showPrintLine(cmd.text);
+            break;
+    }
+}
+
+void Tc001::splashScreen(bool showProgress) {
+    postCommand(CMD_SPLASH_SCREEN, showProgress);
 }
 
 void Tc001::configServerMsg(const char *msg) {
-    configServerMsg(msg, true);
+    postCommand(CMD_CONFIG_SERVER_MSG, true);
 }
 
-void Tc001::displayRoundWithCountdown(int currentRound, int totalRounds) {
-    uint16_t activeColor = COLOR_DEEPSKYBLUE,
-             inactiveColor = COLOR_DARKGRAY;
-    const int line = 7;
-    int displayWidth = matrix.width();
-    matrix.drawFastHLine(0, line, displayWidth, COLOR_BLACK);
-    if (totalRounds < displayWidth / 2) {
-        int lineWidth = displayWidth / totalRounds, offset;
-        switch (totalRounds) {
-            case 3:
-            case 5:
-            case 14:
-                offset = 2;
-                break;
-            case 7:
-            case 9:
-            case 13:
-                offset = 3;
-                break;
-            case 12:
-                offset = 4;
-                break;
-            case 11:
-                offset = 5;
-                break;
-            default:
-                offset = 1;
-        }
-        for (int i = 0; i < totalRounds; i++) {
-            matrix.drawFastHLine(i * lineWidth + offset, line, lineWidth - 1, (i == currentRound - 1) ? activeColor : inactiveColor);
-        }
-    } else {
-        int t = totalRounds <= displayWidth ? totalRounds : displayWidth;
-        int start = (displayWidth - (t + (t <= displayWidth - 2 ? 2 : 0))) / 2;
-        for (int i = 0; i < t; i++) {
-            if (totalRounds <= displayWidth - 2 && (i == currentRound - 1 || i == currentRound)) {
-                start++;
-            }
-            matrix.drawPixel(start + i, line, (i == currentRound - 1) ? activeColor : inactiveColor);
-        }
-    }
+void Tc001::showConfigServerMsg(bool loop) {
+    String msgStr = "Config page http://" + WiFi.localIP().toString();
+    screens.showConfigServerMsg(msgStr.c_str(), loop);
 }
 
 void Tc001::displayEventName(const CBCPEvent& event) {
     displayState = DISPLAY_EVENT_NAME;
-    stopAnimations();
-    matrix.clear();
-    scrollingText = new ScrollingText(&matrix, BCPEvent.name(), 0, 7, defaultFont, true);
-    matrix.show();
+    postCommand(CMD_EVENT_NAME, 0, event.name().c_str());
 }
 
 void Tc001::displayEventRound(const CBCPEvent& event) {
     displayState = DISPLAY_EVENT_ROUND;
-    stopAnimations();
-    matrix.clear();
-    matrix.setTextColor(COLOR_WHITE);
-    int16_t  x1, y1;
-    uint16_t w, h;
-    String msg = "Round " + String(BCPEvent.currentRound());
-    matrix.getTextBounds(msg, 0, 7, &x1, &y1, &w, &h);
-    matrix.setCursor((matrix.width() - w) / 2, 7);
-    matrix.print(msg);
-    matrix.show();
-}
-
-void Tc001::displayCountdown(const CBCPEvent& event) {
-    long remaining = BCPEvent.roundEndEpoch() - time(nullptr);
-    bool dontDisplayHours = BCPEvent.timerLength() <= 3600;
-
-    if (BCPEvent.timerPaused()) {
-        // timer is paused
-        remaining = BCPEvent.pausedTimeRemaining();
-        matrix.setTextColor(time(nullptr) % 2 ? COLOR_MAGENTA : COLOR_BLACK);
-    } else if (remaining <= Config.redThreshold()) {
-        // we are below red threshold of the timer
-        matrix.setTextColor(COLOR_RED);
-    } else if (remaining <= Config.yellowThreshold()) {
-        // we are below yellow threshold of the timer
-        matrix.setTextColor(COLOR_YELLOW);
-    } else if (remaining > BCPEvent.timerLength() || (remaining == BCPEvent.timerLength() && BCPEvent.timerLength() <= 3600)) {
-        // event round not yet started, show time to start
-        matrix.setTextColor(COLOR_GREEN);
-        remaining -= BCPEvent.timerLength();
-        dontDisplayHours = remaining < 3600 && BCPEvent.timerLength() <= 3600;
-    } else {
-        matrix.setTextColor(COLOR_WHITE);
-    }
-
-    String out  = remaining < 0 ? "-" : "";
-    int absoluteTime = remaining < 0 ? -remaining : remaining;
-    int hours = absoluteTime / 3600;
-    int minutes = (absoluteTime % 3600) / 60;
-    int seconds = absoluteTime % 60;
-
-    int x, y;
-
-    if (dontDisplayHours) {
-        // mm:ss
-        matrix.setFont(mmssFont);
-        x = remaining < 0 ? 1 : 5;
-        y = 6;
-        if (remaining < -3599) {
-            out = "-//://";    // To save space in the font, X bitmap mapped to / character
-        } else {
-            out += String(minutes / 10) + String(minutes % 10) + ":" +
-                   String(seconds / 10) + String(seconds % 10);
-        }
-    } else {
-        // h:mm:ss
-        matrix.setFont(hmmssFont);
-        x = remaining < 0 ? -1 : 3;
-        y = 1;
-        if (remaining < -35999) {
-            out = "-/://://";  // To save space in the font, X bitmap mapped to / character
-        } else {
-            out += String(hours) + ":" +
-                String(minutes / 10) + String(minutes % 10) + ":" +
-                String(seconds / 10) + String(seconds % 10);
-        }
-    }
-
-    matrix.clear();
-    matrix.setCursor(x, 6);
-    matrix.print(out);
-    displayRoundWithCountdown(BCPEvent.currentRound(), BCPEvent.numberOfRounds());
-    matrix.show();
-    matrix.setFont((GFXfont *) defaultFont);
-}
-
-void Tc001::progressStart() {
-    if (progressIndicator == nullptr) {
-        progressIndicator = new ProgressIndicator(&matrix, -1, matrix.height() - 1, matrix.width(), COLOR_WHITE, COLOR_BLACK);
-    }
-    progressIndicator->isActive = true;
-}
-
-void Tc001::progressStep() {
-    if (progressIndicator != nullptr && progressIndicator->isActive) {
-        progressIndicator->step(true);
-    }
+    postCommand(CMD_EVENT_ROUND, event.currentRound());
 }
 
-void Tc001::progressStop() {
-    if (progressIndicator != nullptr && progressIndicator->isActive) {
-        progressIndicator->hide();
-        progressIndicator->isActive = false;
-    }
+void Tc001::displayCountdown(const CBCPEvent& event, time_t now) {
+    screens.setThresholds(Config.yellowThreshold(), Config.redThreshold());
+    screens.showCountdown(event, now);
 }
 
 void Tc001::reboot() {
@@ -277,8 +146,10 @@ bool Tc001::ensureConnection() {
 
 void Tc001::eventHandler(void * parameter) {
     while (true) {
-        bool showMatrix;
-        showMatrix = false;
+        DisplayCommand cmd;
+        while (commands.pop(cmd)) {
+            runCommand(cmd);
+        }
 
         if (midButtonPressed) {
             static unsigned long lastPress = millis();
@@ -286,10 +157,8 @@ void Tc001::eventHandler(void * parameter) {
             if (now - lastPress >= DEBOUNCE_DELAY_MS) {
                 lastPress = now;
                 midButtonPressed = false;
-                displayState = DISPLAY_DONT_UPDATE;
-                stopAnimations();
                 Config.startConfigServer();
-                configServerMsg("", false);
+                showConfigServerMsg(false);
             }
         }
 
@@ -297,80 +166,45 @@ void Tc001::eventHandler(void * parameter) {
             Config.handleClient();
         }
 
-        if (displayState == DISPLAY_DONT_UPDATE && scrollingText && !scrollingText->isActive) {
-            delete scrollingText;
-            scrollingText = nullptr;
-            displayState = DISPLAY_ENFORCE_REFRESH;
+        struct timeval now;
+        if (displayState == DISPLAY_EVENT_COUNTDOWN && secondTick(screens.tickSecond, now)) {
+            displayCountdown(BCPEvent, now.tv_sec);
         }
 
-        if (scrollingText && scrollingText->isActive && (stMillis == 0 || millis() - stMillis > SCROLLING_TEXT_SPEED)) {
-            stMillis = (stMillis == 0) ? millis() : stMillis + SCROLLING_TEXT_SPEED;
-            scrollingText->step(true);
-            showMatrix = true;
+        bool brightnessChanged = autoBrightness.update(millis());
+        if (brightnessChanged) {
+            FastLED.setBrightness(autoBrightness.brightness());
         }
-
-        if (progressIndicator && progressIndicator->isActive && (piMillis == 0 || millis() - piMillis > PROGRESS_INDICATOR_SPEED)) {
-            piMillis = (piMillis == 0) ? millis() : piMillis + PROGRESS_INDICATOR_SPEED;
-            progressStep();
-            showMatrix = true;
-        }
-
-        if (displayState == DISPLAY_EVENT_COUNTDOWN && (lMillis == 0 || millis() - lMillis > 1000)) {
-            lMillis = (lMillis == 0) ? millis() : lMillis + 1000;
-            stopAnimations();
-            displayCountdown(BCPEvent);
-            showMatrix = true;
+        if (screens.frame(millis()) || brightnessChanged) {
+            FastLED.show();
         }
+        estimateCurrent(millis());
 
-        if (showMatrix) {
-            matrix.show();
+        // next frame in 10 ms, or right after the second boundary if it comes sooner
+        uint32_t delayMs = 10;
+        if (displayState == DISPLAY_EVENT_COUNTDOWN) {
+            delayMs = _min(delayMs, msToNextSecond() + 1);
         }
+        vTaskDelay(pdMS_TO_TICKS(delayMs));
+    }
+}
 
-        vTaskDelay(pdMS_TO_TICKS(10));
+// Current of the frame shown, by the FastLED power model, which scales the brightness down
+// further if the frame would go over the power budget. Only read for the log, so once a while.
+void Tc001::estimateCurrent(uint32_t now) {
+    static uint32_t lastEstimate = 0;
+    if (now - lastEstimate < CURRENT_ESTIMATE_INTERVAL_MS) {
+        return;
     }
+    lastEstimate = now;
+    displayCurrentMa = AutoBrightness::estimateMilliamps(matrixleds, MatrixXY::size, autoBrightness.brightness(), AUTO_BRIGHTNESS_LED_VOLTS * TC001_POWER_BUDGET_MA);
+    displayFullCurrentMa = AutoBrightness::estimateMilliamps(matrixleds, MatrixXY::size, 255);
 }
 
 size_t Tc001::write(uint8_t c) {
     if (c == '\n' || bufferIndex >= sizeof(buffer) - 1) {
         buffer[bufferIndex] = '\0';
-
-        if (strncmp(buffer, "Error:", 6) == 0) {
-            // Error message, display in red
-            stopAnimations();
-            matrix.clear();
-            scrollingText = new ScrollingText(&matrix, buffer, 0, 7, (const GFXfont *) defaultFont, false, COLOR_RED);
-            if (initMsg_.length() > 0) {
-                scrollingText->append(initMsg_, COLOR_WHITE, true);
-            } else {
-                errorShown_ = true;
-            }
-
-        } else if (strncmp(buffer, "Connecting ", 11) == 0) {
-            // Connecting message, show progress indicator
-            stopAnimations();
-            matrix.clear();
-            matrix.setCursor(2, 6);
-            matrix.setTextColor(COLOR_WHITE);
-            matrix.print("Connect");
-            progressStart();
-
-        } else if (strncmp(buffer, "Connected ", 10) == 0) {
-            // do nothing, let the current status message continue
-
-        } else {
-            if (errorShown_) {
-                scrollingText->append(buffer, COLOR_WHITE, true);
-                errorShown_ = false;
-            } else {
-                stopAnimations();
-                matrix.clear();
-                scrollingText = new ScrollingText(&matrix, buffer, 0, 7, (const GFXfont *) defaultFont);
-            }
-            matrix.print(buffer);
-            if (initMsg_.length() == 0) initMsg_ = String(buffer);
-        }
-
-        matrix.show();
+        postCommand(CMD_PRINT_LINE, 0, buffer);
         bufferIndex = 0;
 
     } else if (c != '\r' && bufferIndex < sizeof(buffer) - 2) {
@@ -378,4 +212,4 @@ size_t Tc001::write(uint8_t c) {
 
     }
     return 1;
-}
\ No newline at end of file
+}
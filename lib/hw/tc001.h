@@ -8,12 +8,30 @@
 #include <Arduino.h>
 #include <Print.h>
 
-#include <Adafruit_GFX.h>
 #include <FastLED.h>
 #include <FastLED_NeoMatrix.h>
 
-#include <progress_indicator.h>
-#include <scrolling_text.h>
+#include <xymap.h>
+
+#include "screens.h"
+#include "spsc_queue.h"
+#include "auto_brightness.h"
+
+// LED wiring of the panels, their geometry is in screens.h
+#ifndef TC001_PANEL_LAYOUT
+#define TC001_PANEL_LAYOUT (NEO_MATRIX_TOP + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS + NEO_MATRIX_ZIGZAG)
+#endif
+
+// Brightness range the light sensor maps into, and the current the LEDs may draw, in mA
+#ifndef TC001_BRIGHTNESS_MIN
+#define TC001_BRIGHTNESS_MIN 8
+#endif
+#ifndef TC001_BRIGHTNESS_MAX
+#define TC001_BRIGHTNESS_MAX 255
+#endif
+#ifndef TC001_POWER_BUDGET_MA
+#define TC001_POWER_BUDGET_MA 1000
+#endif
 
 class Tc001 : public Hw, public Print {
 
@@ -50,28 +68,37 @@ private:
         }
     }
 
-    static CRGB matrixleds[256];
-    static FastLED_NeoMatrix matrix;
-
-    static const UTF8_32BitFont *defaultFont;
-    static const GFXfont *hmmssFont;
-    static const GFXfont *mmssFont;
-
-    static ProgressIndicator *progressIndicator;
-    static ScrollingText *scrollingText;
-    static unsigned long stMillis, piMillis, lMillis;
-    static void stopAnimations();
+    typedef XYMap<TC001_PANEL_WIDTH, TC001_PANEL_HEIGHT, TC001_PANEL_LAYOUT, TC001_PANELS_X, TC001_PANELS_Y> MatrixXY;
+    static CRGB matrixleds[MatrixXY::size];
+    static Screens screens;     // drawn on the EventHandler task only
+    static AutoBrightness autoBrightness;
+    static void estimateCurrent(uint32_t now);
 
     static bool midButtonPressed;
 
-    static void displayCountdown(const CBCPEvent& event);
-    static void displayRoundWithCountdown(int currentRound, int totalRounds);
-
-    static void progressStart();
-    static void progressStep();
-    static void progressStop();
-
-    static void configServerMsg(const char *msg, bool loop = true);
+    // ---- Display commands ----
+    // Everything drawing into the layers runs on the EventHandler task only.
+    // Other tasks post a command, which is executed at the start of the next frame.
+    enum DisplayCommandType {
+        CMD_SPLASH_SCREEN,
+        CMD_EVENT_NAME,
+        CMD_EVENT_ROUND,
+        CMD_CONFIG_SERVER_MSG,
+        CMD_PRINT_LINE
+    };
+    struct DisplayCommand {
+        DisplayCommandType type;
+        int arg;
+        char text[256];
+    };
+    static SpscQueue<DisplayCommand, 8> commands;
+    static TaskHandle_t eventHandlerTask;
+    static void postCommand(DisplayCommandType type, int arg = 0, const char *text = nullptr);
+    static void pushCommand(const DisplayCommand& cmd);
+    static void runCommand(const DisplayCommand& cmd);
+
+    static void showConfigServerMsg(bool loop);
+    static void displayCountdown(const CBCPEvent& event, time_t now);
 
 // ---- Print interface ----
 public:
@@ -80,6 +107,4 @@ public:
 private:
     char buffer[256];
     size_t bufferIndex;
-    String initMsg_ = String();
-    bool errorShown_ = false;
 };
\ No newline at end of file
@@ -0,0 +1,416 @@
+// Rendering microbenchmarks of the GFX and display hot paths, firmware of its own
+// (env nodemcu-32s-bench) in place of the clock, or the bench target of the host build
+// (c) 2025 Honza Skýpala
+// WTFPL license applies
+
+#include <Arduino.h>
+#include <screens.h>
+#include <xymap.h>
+#include <layer.h>
+#include <compositor.h>
+#include <effect.h>
+#include <layout_cache.h>
+#include <font_index.h>
+#include <utf8_decoder.h>
+#include <scrolling_text.h>
+#include <sprite_atlas.h>
+#include <f3x5.h>
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_heap_caps.h>
+#else
+#include <malloc.h>
+#endif
+
+// Results go to Serial as JSON lines, one per benchmark and input, to be diffed between
+// commits: {"bench":"...","input":"...","iterations":N,"ns_per_op":N,"bytes_per_op":N,"allocs_per_op":N,"frees_per_op":N}
+// Heap use is counted by the allocator wrappers below, linked in by -Wl,--wrap=malloc
+// (and calloc, realloc, free), so String buffers and pool fallbacks are counted too.
+// Bytes are gross, allocated whether freed or not, a realloc counting only its growth;
+// allocations left unfreed show as allocs_per_op above frees_per_op.
+#define BENCH_ITERATIONS 1000
+#define BENCH_WARMUP 10
+
+// ---- Allocation counting ----
+
+static volatile uint32_t allocatedBytes = 0;
+static volatile uint32_t allocations = 0;
+static volatile uint32_t frees = 0;
+
+// Usable size of a heap block, at least the size asked for
+static size_t blockSize(void *p) {
+#ifdef ARDUINO_ARCH_ESP32
+    return heap_caps_get_allocated_size(p);
+#else
+    return malloc_usable_size(p);
+#endif
+}
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t size);
+void __real_free(void *p);
+
+void *__wrap_malloc(size_t size) {
+    allocatedBytes += size;
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    allocatedBytes += n * size;
+    allocations++;
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *p, size_t size) {
+    size_t old = (p != nullptr) ? blockSize(p) : 0;
+    if (size > old) {
+        allocatedBytes += size - old;
+    }
+    allocations++;
+    return __real_realloc(p, size);
+}
+
+void __wrap_free(void *p) {
+    if (p != nullptr) {
+        frees++;
+    }
+    __real_free(p);
+}
+}
+
+// The counters move only with the wrappers linked in, the benchmarks would report no
+// allocations at all otherwise.
+static bool allocationsCounted() {
+    uint32_t allocs = allocations, freed = frees;
+    void *volatile p = malloc(16);
+    free(p);
+    return allocations == allocs + 1 && frees == freed + 1;
+}
+
+// ---- Runner ----
+
+static void report(const char *bench, const char *input, uint32_t iterations, uint32_t elapsedUs, uint32_t bytes, uint32_t allocs, uint32_t freed) {
+    Serial.print("{\"bench\":\"" + String(bench) + "\",\"input\":\"" + String(input) + "\"");
+    Serial.print(",\"iterations\":" + String(iterations));
+    Serial.print(",\"ns_per_op\":" + String((uint32_t) ((uint64_t) elapsedUs * 1000 / iterations)));
+    Serial.print(",\"bytes_per_op\":" + String((float) bytes / iterations, 2));
+    Serial.print(",\"allocs_per_op\":" + String((float) allocs / iterations, 2));
+    Serial.println(",\"frees_per_op\":" + String((float) freed / iterations, 2) + "}");
+}
+
+// Runs op(i) for i = 0 .. iterations - 1, after a few warm up calls filling the caches.
+// Counters are read before the report, its String building not counted.
+template <typename Op>
+static void bench(const char *name, const char *input, Op op, uint32_t iterations = BENCH_ITERATIONS) {
+    for (uint32_t i = 0; i < BENCH_WARMUP; i++) {
+        op(i);
+    }
+    uint32_t bytes = allocatedBytes, allocs = allocations, freed = frees;
+    uint32_t start = micros();
+    for (uint32_t i = 0; i < iterations; i++) {
+        op(i);
+    }
+    uint32_t elapsedUs = micros() - start;
+    bytes = allocatedBytes - bytes;
+    allocs = allocations - allocs;
+    freed = frees - freed;
+    report(name, input, iterations, elapsedUs, bytes, allocs, freed);
+}
+
+// ---- Inputs ----
+
+static const UTF8_32BitFont *font = &F3x5[0];
+
+struct TextInput {
+    const char *name;
+    const char *text;
+};
+
+static const TextInput texts[] = {
+    { "short", "Round 3" },
+    { "long", "Warhammer 40k Grand Tournament 2025 - Day 2, Prague Open" },
+    { "diacritics", "Příliš žluťoučký kůň úpěl ďábelské ódy" },
+    { "emoji", "GT \xF0\x9F\x8F\x86 \xF0\x9F\x87\xA8\xF0\x9F\x87\xBF Praha \xF0\x9F\x8E\xB2" }
+};
+
+static Layer layer(32, 8);
+
+// Screens of the TC001 drawing into LEDs of their own; set up first, as on the device,
+// so that emoji sprites and flags are registered for all text drawn
+typedef XYMap<Screens::width, Screens::height, NEO_MATRIX_TOP + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS + NEO_MATRIX_PROGRESSIVE> BenchXY;
+static CRGB leds[BenchXY::size];
+static Screens screens(leds, BenchXY::table.xy);
+
+static void benchScrollingText() {
+    for (const TextInput &t : texts) {
+        ScrollingText text(&layer, t.text, 0, 7, font, true, 1, 32, 8, true);
+        bench("scrolling_text.step", t.name, [&](uint32_t) { text.step(); });
+        bench("scrolling_text.draw", t.name, [&](uint32_t) { text.draw(); });
+    }
+    for (const TextInput &t : texts) {
+        bench("scrolling_text.create", t.name, [&](uint32_t) {
+            ScrollingText text(&layer, t.text, 0, 7, font, true, 1, 32);
+        });
+    }
+}
+
+// Whole text decoded per op, the sum of codepoints kept so the loop is not optimized out
+static void benchUtf8Decoder() {
+    volatile uint32_t sum = 0;
+    for (const TextInput &t : texts) {
+        bench("utf8_decoder.decode", t.name, [&](uint32_t) {
+            UTF8Decoder decoder;
+            uint32_t cp[2], s = 0;
+            for (const char *c = t.text; *c; c++) {
+                for (uint8_t i = 0, n = decoder.feed(*c, cp); i < n; i++) {
+                    s += cp[i];
+                }
+            }
+            if (decoder.finish(cp)) {
+                s += cp[0];
+            }
+            sum = sum + s;
+        });
+    }
+}
+
+// Glyph lookups over event names of mixed scripts, one codepoint per op, so lookups per
+// second are 10^9 / ns_per_op. Codepoints of each corpus are decoded beforehand.
+static const TextInput corpora[] = {
+    { "mixed", "Prague Open, \xC5\xA0" "achov\xC3\xBD turnaj \xC5\xBD\xC4\x8F\xC3\xA1r, \xD0\x9C\xD0\xBE\xD1\x81\xD0\xBA\xD0\xB2\xD0\xB0 \xE2\x86\x92 \xF0\x9F\x87\xA8\xF0\x9F\x87\xBF\xF0\x9F\x87\xB8\xF0\x9F\x87\xB0 GT \xF0\x9F\x8F\x86" },
+    { "cyrillic", "\xD0\x9C\xD0\xBE\xD1\x81\xD0\xBA\xD0\xBE\xD0\xB2\xD1\x81\xD0\xBA\xD0\xB8\xD0\xB9 \xD1\x82\xD1\x83\xD1\x80\xD0\xBD\xD0\xB8\xD1\x80" },
+    { "flags", "\xF0\x9F\x87\xA8\xF0\x9F\x87\xBF\xF0\x9F\x87\xB8\xF0\x9F\x87\xB0\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA\xF0\x9F\x87\xB5\xF0\x9F\x87\xB1" },
+    { "arrows", "\xE2\x86\x90\xE2\x86\x91\xE2\x86\x92\xE2\x86\x93\xE2\x86\x94\xE2\x86\x95" }
+};
+
+static void benchFontIndex() {
+    FontIndex *index = FontIndex::get((const GFXfont *) font, true, true);
+    const GFXfont *segment;
+    volatile uintptr_t found = 0;
+    for (const TextInput &t : corpora) {
+        uint32_t cps[128], cp[2];
+        uint16_t count = 0;
+        UTF8Decoder decoder;
+        for (const char *c = t.text; *c; c++) {
+            for (uint8_t i = 0, n = decoder.feed(*c, cp); i < n && count < 128; i++) {
+                cps[count++] = cp[i];
+            }
+        }
+        bench("font_index.find", t.name, [&](uint32_t i) {
+            found = found + (uintptr_t) index->find(cps[i % count], &segment);
+        }, BENCH_ITERATIONS * 100);
+    }
+}
+
+static void benchCanvas() {
+    layer.setTextWrap(false);
+    layer.setFont((const GFXfont *) font);
+    for (const TextInput &t : texts) {
+        bench("utf8canvas16.write", t.name, [&](uint32_t) {
+            layer.setCursor(0, 7);
+            layer.print(t.text);
+        });
+    }
+}
+
+// Characters drawn one per op, each at the start of the line, so characters rendered per
+// millisecond are 10^6 / ns_per_op
+static const TextInput characters[] = {
+    { "ascii", "Round 3 12:34 Prague Open" },
+    { "accented", "\xC5\xA0" "achov\xC3\xBD turnaj \xC5\xBD\xC4\x8F\xC3\xA1r nad S\xC3\xA1zavou" },
+    { "emoji", "\xE2\x9A\x94\xE2\x9D\xA4\xF0\x9F\x8E\xB2\xF0\x9F\x8F\x86\xF0\x9F\x91\x8D\xF0\x9F\x94\xA5\xF0\x9F\x98\x80" }
+};
+
+static void benchCanvasChars() {
+    layer.setTextWrap(false);
+    layer.setFont((const GFXfont *) font);
+    for (const TextInput &t : characters) {
+        uint16_t starts[64], count = 0;
+        for (uint16_t i = 0; t.text[i] && count < 63; i++) {
+            if ((t.text[i] & 0xC0) != 0x80) {
+                starts[count++] = i;
+            }
+        }
+        starts[count] = strlen(t.text);
+        bench("utf8canvas16.write_char", t.name, [&](uint32_t i) {
+            uint16_t k = i % count;
+            layer.setCursor(0, 7);
+            layer.write((const uint8_t *) t.text + starts[k], starts[k + 1] - starts[k]);
+        }, BENCH_ITERATIONS * 100);
+    }
+}
+
+// Text dimensions are measured through the layout cache, hits and misses
+static void benchTextBounds() {
+    int16_t x1, y1;
+    uint16_t w, h;
+    for (const TextInput &t : texts) {
+        bench("layout_cache.get_text_bounds", t.name, [&](uint32_t) {
+            LayoutCache::getTextBounds(t.text, (const GFXfont *) font, true, true, 0, 7, &x1, &y1, &w, &h);
+        });
+    }
+    char buffer[16];
+    bench("layout_cache.get_text_bounds", "miss", [&](uint32_t i) {
+        snprintf(buffer, sizeof(buffer), "Round %u", (unsigned) i);
+        LayoutCache::getTextBounds(buffer, (const GFXfont *) font, true, true, 0, 7, &x1, &y1, &w, &h);
+    });
+}
+
+// Sprites decoded from their runs: one column per op, what a scroll step takes per sprite
+// in the window each frame, and the whole sprite, columns one after the other
+static const struct { uint8_t glyph; const char *name; } sprites[] = {
+    { 3, "trophy" },
+    { 5, "fire" },
+    { 6, "grinning" },
+    { 10, "flag_cz" }
+};
+
+static void benchSprites() {
+    const uint16_t *colors = Sprites::colors(EmojiSprites);
+    uint16_t out[8 * 8];
+    for (const auto &s : sprites) {
+        const GFXglyph *glyph = &EmojiGlyphs[s.glyph];
+        uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+        bench("sprite_atlas.draw_column", s.name, [&](uint32_t i) {
+            Sprites::drawColumn(glyph, EmojiSprites, colors, i % w, out, 1, 0, h);
+        }, BENCH_ITERATIONS * 10);
+        bench("sprite_atlas.draw", s.name, [&](uint32_t) {
+            for (uint8_t col = 0; col < w; col++) {
+                Sprites::drawColumn(glyph, EmojiSprites, colors, col, out + col, w, 0, h);
+            }
+        }, BENCH_ITERATIONS * 10);
+    }
+}
+
+// Countdown and round bar, drawn by the screens into the LEDs.
+// Every op shows the next second, so digits keep changing; rolls end within the frames.
+static void benchCountdown() {
+    bench("display_countdown", "mm:ss", [&](uint32_t i) {
+        screens.showCountdown(3000 - (i % 3000), 3600, false, 2, 5, i);
+    });
+    bench("display_countdown", "h:mm:ss", [&](uint32_t i) {
+        screens.showCountdown(9000 - (i % 9000), 10800, false, 2, 5, i);
+    });
+    bench("display_countdown", "overtime", [&](uint32_t i) {
+        screens.showCountdown(-100 - (long) i, 3600, false, 2, 5, i);
+    });
+    bench("display_countdown", "mm:ss+frames", [&](uint32_t i) {
+        uint32_t start = millis();  // rolls start now, the frames follow at 10 ms
+        screens.showCountdown(3000 - (i % 3000), 3600, false, 2, 5, i);
+        for (uint8_t f = 1; f <= 25; f++) {
+            screens.frame(start + 10 * f);  // a second of rolling and composing at 10 ms
+        }
+    }, BENCH_ITERATIONS / 10);
+    static const int rounds[] = { 3, 5, 8, 15, 16, 24, 40 };
+    for (int r : rounds) {
+        String input = String(r) + " rounds";
+        bench("display_round_with_countdown", input.c_str(), [&](uint32_t i) {
+            screens.showRoundWithCountdown(1 + i % r, r);
+        });
+    }
+}
+
+// ScrollingText::draw onto the LEDs of the TC001 wiring. Before the XY table every pixel
+// went through a virtual call, a bounds check, the zig-zag remap and the RGB565 expansion
+// of FastLED_NeoMatrix, as PixelMatrix does here; now the text is drawn into a layer and
+// composed into the LEDs row by row through the table. Each op is a scroll step.
+typedef XYMap<Screens::width, Screens::height, NEO_MATRIX_TOP + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS + NEO_MATRIX_ZIGZAG> ZigzagXY;
+
+class PixelMatrix : public Adafruit_GFX {
+public:
+    PixelMatrix(CRGB *leds) : Adafruit_GFX(ZigzagXY::width, ZigzagXY::height), leds_(leds) {}
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (x < 0 || y < 0 || x >= _width || y >= _height) {
+            return;
+        }
+        uint8_t r = (color >> 11) & 0x1F, g = (color >> 5) & 0x3F, b = color & 0x1F;
+        leds_[ZigzagXY::index(x, y)] = CRGB((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+    }
+
+private:
+    CRGB *leds_;
+};
+
+static void benchDrawToLeds() {
+    PixelMatrix matrix(leds);
+    Layer text(Screens::width, Screens::height);
+    Compositor compositor(leds, ZigzagXY::table.xy, Screens::width, Screens::height);
+    compositor.addLayer(&text);
+    for (const TextInput &t : texts) {
+        ScrollingText before(&matrix, t.text, 0, 7, font, true, 0xFFFF, Screens::width, 8, true);
+        bench("scrolling_text.draw_per_pixel", t.name, [&](uint32_t) {
+            before.step(false);
+            before.draw();
+        });
+    }
+    for (const TextInput &t : texts) {
+        ScrollingText after(&text, t.text, 0, 7, font, true, 0xFFFF, Screens::width, 8, true);
+        bench("scrolling_text.draw_composed", t.name, [&](uint32_t i) {
+            after.step(false);
+            after.draw();
+            compositor.compose(i);
+        });
+    }
+}
+
+// Effects recoloring the composed text, the time moved by 10 ms each op, so the phase
+// changes and the clip area is recomposed every frame
+static void benchEffects() {
+    Layer text(Screens::width, Screens::height);
+    text.setTextWrap(false);
+    text.setFont((const GFXfont *) font);
+    text.setTextColor(0xFFFF);
+    text.setCursor(0, 7);
+    text.print("12:34");
+    Effect effect;
+    effect.setTarget(&text);
+    effect.setClip(0, 0, Screens::width, Screens::height);
+    Compositor compositor(leds, BenchXY::table.xy, Screens::width, Screens::height);
+    compositor.addLayer(&text);
+    compositor.addEffect(&effect);
+    static const struct { EffectType type; const char *name; } effects[] = {
+        { EFFECT_NONE, "none" },
+        { EFFECT_RAINBOW, "rainbow" },
+        { EFFECT_PULSE, "pulse" },
+        { EFFECT_GRADIENT, "gradient" }
+    };
+    for (const auto &e : effects) {
+        effect.set(e.type);
+        compositor.invalidate();
+        bench("compositor.compose", e.name, [&](uint32_t i) { compositor.compose(i * 10); });
+    }
+}
+
+void setup() {
+    Serial.begin(9600);
+    while (!Serial);
+    delay(1000);
+#ifdef ARDUINO_ARCH_ESP32
+    Serial.println("{\"suite\":\"bcp-clock-gfx\",\"cpu_mhz\":" + String(getCpuFrequencyMhz()) + "}");
+#else
+    Serial.println("{\"suite\":\"bcp-clock-gfx\"}");
+#endif
+    if (!allocationsCounted()) {
+        Serial.println("{\"error\":\"allocator wrappers not linked in, see the -Wl,--wrap build flags\"}");
+        return;
+    }
+    screens.begin();
+    benchScrollingText();
+    benchUtf8Decoder();
+    benchFontIndex();
+    benchCanvas();
+    benchCanvasChars();
+    benchTextBounds();
+    benchCountdown();
+    benchSprites();
+    benchDrawToLeds();
+    benchEffects();
+    Serial.println("{\"done\":true}");
+}
+
+void loop() {
+    delay(1000);
+}
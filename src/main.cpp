@@ -113,7 +113,6 @@ void loop() {
         if (Config.eventId() != BCPEvent.fullId()) {
             MAIN_DEBUG("Event ID changed, updating BCP event.");
             hw->displayState = DISPLAY_DONT_UPDATE;
-            delay(50); // let any ongoing display updates finish
             hw->splashScreen();
             BCPEvent.setID(Config.eventId());
             lastDataRefresh = 0; // force data refresh
@@ -126,6 +125,11 @@ void loop() {
         MAIN_DEBUG("Refreshing BCP event data...");
         hw->enforceUpdate = false;
         lastDataRefresh = millis();
+        if (hw->displayState == DISPLAY_EVENT_COUNTDOWN) {
+            MAIN_DEBUG("Countdown tick phase error " + String(hw->tickPhaseErrorUs) + " us, max " + String(hw->tickPhaseErrorMaxUs) + " us");
+            hw->tickPhaseErrorMaxUs = 0;    // max per report interval
+        }
+        MAIN_DEBUG("Display current estimated " + String(hw->displayCurrentMa) + " mA, " + String(hw->displayFullCurrentMa) + " mA at full brightness");
         if (BCPEvent.refreshData()) {
             MAIN_DEBUG("BCP event data refreshed successfully");
             failCount = 0;
@@ -0,0 +1,558 @@
+#!/usr/bin/env python3
+# Font compiler - builds UTF8_32BitFont / GFXfont headers from pixel-art or BDF sources
+# (c) 2025 Honza Skýpala
+# WTFPL license applies
+"""
+Font compiler for the bitmap fonts in lib/gfx.
+
+    fontc.py import lib/gfx/f3x5.h --font F3x5 > f3x5.txt
+    fontc.py build f3x5.txt [more.txt|font.bdf ...] --name F3x5 -o lib/gfx/f3x5.h
+    fontc.py build f4x6.txt --name F4x6 --gfxfont -o lib/gfx/f4x6.h
+    fontc.py build f3x5.txt --name F3x5 --share F3x5_Fixed=f3x5_fixed.txt -o lib/gfx/f3x5.h
+    fontc.py atlas emoji.txt --name Emoji -o lib/gfx/emoji.h
+
+Pixel-art source: a glyph starts with a line "U+XXXX key=value ..." (keys advance,
+xoff, yoff and optionally width when there are no rows), followed by its rows of
+'#' (set) and '.' (clear). Lines starting with '#' followed by a space are comments,
+"yadvance N" sets the line height. Later sources override glyphs of earlier ones.
+
+    yadvance 6
+    U+0041 advance=4 xoff=0 yoff=-5   # A
+    .#.
+    #.#
+    ###
+    #.#
+    #.#
+
+Sprite atlas source uses the same glyph headers, "palette K RRGGBB" lines
+define up to 15 colors and rows are made of their keys, '.' being transparent.
+Headers "flag CZ key=value ..." declare flag sprites, composed from regional
+indicator pairs; they get consecutive codepoints from U+F0000 on.
+
+Glyph bitmaps are packed MSB first and continuously across rows, each glyph
+starting on a byte boundary (as Adafruit GFX expects). Identical glyphs, glyphs
+contained in others and overlapping head/tail bytes are shared; the unused bits
+in the last byte of a glyph match anything. Codepoints are split into segments
+where a gap of empty glyphs would cost more flash than another segment entry.
+"""
+
+import argparse
+import math
+import re
+import sys
+import unicodedata
+
+FLAG_FIRST = 0xF0000  # flags get consecutive codepoints from the supplementary private use area
+GLYPH_BYTES = 8       # sizeof(GFXglyph) on ESP32
+SEGMENT_BYTES = 24    # sizeof(UTF8_32BitFont) on ESP32
+
+
+class Glyph:
+    def __init__(self, cp, width, height, advance, xoff, yoff, rows):
+        self.cp, self.width, self.height = cp, width, height
+        self.advance, self.xoff, self.yoff = advance, xoff, yoff
+        self.rows = rows    # list of strings of '#' / '.'
+        self.offset = 0
+
+    def bits(self):
+        return ''.join('1' if ch == '#' else '0' for row in self.rows for ch in row)
+
+    def packed(self):
+        """Bitmap bytes as (value, mask) pairs, padding bits of the last byte are don't care."""
+        bits = self.bits()
+        out = []
+        for i in range(0, len(bits), 8):
+            chunk = bits[i:i + 8]
+            value = int(chunk.ljust(8, '0'), 2)
+            mask = (0xFF << (8 - len(chunk))) & 0xFF
+            out.append((value, mask))
+        return out
+
+
+# ---- Sources ----
+
+def parse_pixelart(path, glyphs, meta):
+    current = None
+    with open(path, encoding='utf-8') as f:
+        for lineno, raw in enumerate(f, 1):
+            line = raw.rstrip('\n')
+            if line.startswith('# ') or not line.strip():
+                current = None if not line.strip() else current
+                continue
+            if line.startswith('yadvance'):
+                meta['yadvance'] = int(line.split()[1])
+                continue
+            if line.startswith('U+'):
+                fields = line.split('#', 1)[0].split() if ' #' in line else line.split()
+                cp = int(fields[0][2:], 16)
+                kv = dict(item.split('=', 1) for item in fields[1:])
+                current = Glyph(cp, int(kv.get('width', 0)), 0, int(kv['advance']),
+                                int(kv.get('xoff', 0)), int(kv.get('yoff', 0)), [])
+                glyphs[cp] = current
+                continue
+            if current is None or set(line) - set('#.'):
+                sys.exit('%s:%d: unexpected line %r' % (path, lineno, line))
+            if current.rows and len(line) != len(current.rows[0]):
+                sys.exit('%s:%d: rows of U+%04X differ in width' % (path, lineno, current.cp))
+            current.rows.append(line)
+            current.width, current.height = len(line), len(current.rows)
+
+
+def parse_bdf(path, glyphs, meta):
+    with open(path, encoding='latin-1') as f:
+        lines = [l.strip() for l in f]
+    ascent = 0
+    i = 0
+    while i < len(lines):
+        words = lines[i].split()
+        if not words:
+            i += 1
+            continue
+        if words[0] == 'FONT_ASCENT':
+            ascent = int(words[1])
+        elif words[0] == 'FONT_DESCENT':
+            meta.setdefault('yadvance', ascent + int(words[1]))
+        elif words[0] == 'STARTCHAR':
+            cp, dwidth, bbx, rows = None, 0, (0, 0, 0, 0), []
+            i += 1
+            while not lines[i].startswith('ENDCHAR'):
+                w = lines[i].split()
+                if w[0] == 'ENCODING':
+                    cp = int(w[1])
+                elif w[0] == 'DWIDTH':
+                    dwidth = int(w[1])
+                elif w[0] == 'BBX':
+                    bbx = tuple(int(v) for v in w[1:5])
+                elif w[0] == 'BITMAP':
+                    i += 1
+                    while not lines[i].startswith('ENDCHAR'):
+                        bits = bin(int(lines[i], 16))[2:].zfill(len(lines[i]) * 4)
+                        rows.append(''.join('#' if b == '1' else '.' for b in bits[:bbx[0]]))
+                        i += 1
+                    break
+                i += 1
+            if cp is not None and cp >= 0:
+                bw, bh, bx, by = bbx
+                glyphs[cp] = Glyph(cp, bw, bh, dwidth, bx, -(by + bh), rows if bw and bh else [])
+        i += 1
+
+
+def load_sources(paths):
+    glyphs, meta = {}, {}
+    for path in paths:
+        if path.lower().endswith('.bdf'):
+            parse_bdf(path, glyphs, meta)
+        else:
+            parse_pixelart(path, glyphs, meta)
+    if 'yadvance' not in meta:
+        meta['yadvance'] = max((g.height for g in glyphs.values()), default=0) + 1
+    return glyphs, meta
+
+
+# ---- Bitmap deduplication ----
+
+def compatible(a, b):
+    return ((a[0] ^ b[0]) & a[1] & b[1]) == 0
+
+
+def merge_byte(a, b):
+    return ((a[0] & a[1]) | (b[0] & b[1]), a[1] | b[1])
+
+
+def find_within(needle, hay):
+    for o in range(len(hay) - len(needle) + 1):
+        if all(compatible(n, hay[o + k]) for k, n in enumerate(needle)):
+            return o
+    return -1
+
+
+def overlap(a, b):
+    """Longest suffix of a matching a prefix of b (shorter than both)."""
+    for k in range(min(len(a), len(b)) - 1, 0, -1):
+        if all(compatible(a[len(a) - k + j], b[j]) for j in range(k)):
+            return k
+    return 0
+
+
+def pack_bitmaps(glyphs):
+    """Greedy shortest common superstring of the glyph bitmaps, sets glyph offsets."""
+    drawn = [g for g in glyphs if g.width and g.height]
+    strings = []    # [bytes as (value, mask) list, [(glyph, offset within string)]]
+    for g in sorted(drawn, key=lambda g: -len(g.packed())):
+        p = g.packed()
+        for s in strings:
+            o = find_within(p, s[0])
+            if o >= 0:
+                for k, b in enumerate(p):
+                    s[0][o + k] = merge_byte(s[0][o + k], b)
+                s[1].append((g, o))
+                break
+        else:
+            strings.append([p, [(g, 0)]])
+
+    # greedy merging of chains by the largest overlap
+    n = len(strings)
+    pairs = []
+    for i in range(n):
+        for j in range(n):
+            if i != j:
+                k = overlap(strings[i][0], strings[j][0])
+                if k:
+                    pairs.append((k, i, j))
+    pairs.sort(key=lambda p: -p[0])
+    succ, pred, chain = {}, {}, list(range(n))
+
+    def root(i):
+        while chain[i] != i:
+            chain[i] = chain[chain[i]]
+            i = chain[i]
+        return i
+
+    for k, i, j in pairs:
+        if i in succ or j in pred or root(i) == root(j):
+            continue
+        a, b = strings[i][0], strings[j][0]
+        if not all(compatible(a[len(a) - k + m], b[m]) for m in range(k)):
+            continue    # wildcards of a got fixed by an earlier merge
+        for m in range(k):
+            a[len(a) - k + m] = b[m] = merge_byte(a[len(a) - k + m], b[m])
+        succ[i], pred[j] = (j, k), i
+        chain[root(j)] = root(i)
+
+    bitmap = []
+    for start in range(n):
+        if start in pred:
+            continue
+        i, k = start, 0
+        while True:
+            base = len(bitmap) - k
+            bitmap.extend(strings[i][0][k:])
+            for g, o in strings[i][1]:
+                g.offset = base + o
+            if i not in succ:
+                break
+            i, k = succ[i]
+    if len(bitmap) > 0xFFFF:
+        sys.exit('bitmap of %d bytes does not fit 16-bit glyph offsets' % len(bitmap))
+    return [v & m for v, m in bitmap]
+
+
+# ---- Segments ----
+
+def split_segments(cps):
+    segments = []
+    for cp in sorted(cps):
+        if segments and (cp - segments[-1][1] - 1) * GLYPH_BYTES <= SEGMENT_BYTES:
+            segments[-1][1] = cp
+        else:
+            segments.append([cp, cp])
+    return segments
+
+
+# ---- Import of existing headers ----
+
+def parse_header(path, font_name):
+    src = open(path, encoding='utf-8').read()
+    arrays = {}
+    for m in re.finditer(r'const(?:expr)?\s+uint8_t\s+(\w+)\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', src, re.S):
+        body = re.sub(r'//.*', '', m.group(2))
+        arrays[m.group(1)] = [int(v, 0) for v in re.findall(r'0b[01]+|0x[0-9a-fA-F]+|\d+', body)]
+    glyph_tables = {}
+    for m in re.finditer(r'const(?:expr)?\s+GFXglyph\s+(\w+)\[\]\s*PROGMEM\s*=\s*\{(.*?)\n\};', src, re.S):
+        glyph_tables[m.group(1)] = [tuple(int(v) for v in e.split(','))
+                                    for e in re.findall(r'\{\s*(-?\d+\s*(?:,\s*-?\d+\s*){5})\}', m.group(2))]
+    m = re.search(r'const(?:expr)?\s+(UTF8_32BitFont|GFXfont)\s+%s(\[\])?\s*PROGMEM\s*=\s*\{(.*?)\n\};' % font_name, src, re.S)
+    if not m:
+        sys.exit('font %s not found in %s' % (font_name, path))
+    utf8 = m.group(1) == 'UTF8_32BitFont'
+    body = m.group(3) if m.group(2) else '{' + m.group(3) + '}'
+    segments = re.findall(r'\{\s*\(uint8_t\s*\*\)\s*(\w+)\s*,\s*\(GFXglyph\s*\*\)\s*&?(\w+)(?:\[(\d+)\])?\s*,'
+                          r'\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*(?:,\s*(\d+)\s*,\s*(\d+))?\s*\}', body)
+    glyphs, yadvance = {}, 0
+    for bitmap_name, table, index, first, last, yadv, dfirst, dlast in segments:
+        bitmap, table, index = arrays[bitmap_name], glyph_tables[table], int(index or 0)
+        first, last, yadvance = int(first), int(last), int(yadv)
+        if utf8 and dfirst and int(dfirst):
+            first, last = int(dfirst), int(dlast)
+        for cp in range(first, last + 1):
+            off, w, h, xa, xo, yo = table[index + cp - first]
+            if (off, w, h, xa, xo, yo) == (0, 0, 0, 0, 0, 0):
+                continue    # gap filler
+            rows = []
+            for r in range(h):
+                row = ''
+                for c in range(w):
+                    bit = r * w + c
+                    row += '#' if bitmap[off + bit // 8] & (0x80 >> (bit % 8)) else '.'
+                rows.append(row)
+            glyphs[cp] = Glyph(cp, w, h, xa, xo, yo, rows)
+    return glyphs, {'yadvance': yadvance}
+
+
+def write_source(glyphs, meta, out):
+    out.write('yadvance %d\n' % meta['yadvance'])
+    for cp in sorted(glyphs):
+        g = glyphs[cp]
+        head = 'U+%04X advance=%d xoff=%d yoff=%d' % (cp, g.advance, g.xoff, g.yoff)
+        if not g.height:
+            head += ' width=%d' % g.width
+        out.write('\n%s   # %s\n' % (head, char_name(cp)))
+        for row in g.rows:
+            out.write(row + '\n')
+
+
+# ---- Output ----
+
+def char_name(cp):
+    if FLAG_FIRST <= cp < FLAG_FIRST + 676:
+        return 'U+%X' % cp
+    if cp == 0x27:
+        return '"\'"'
+    if cp == 0x5C:
+        return "'\\\\'"
+    # controls, format (bidi marks) and line separators would garble the comment, or trip -Wbidi-chars
+    return "'%s'" % chr(cp) if unicodedata.category(chr(cp)) not in ('Cc', 'Cf', 'Zl', 'Zp') else 'U+%04X' % cp
+
+
+def write_glyphs(out, table, glyphs, segments):
+    # constexpr, so that layouts can be computed from the metrics at compile time
+    out.write('inline constexpr GFXglyph %s[] PROGMEM = {\n' % table)
+    starts = []
+    for first, last in segments:
+        starts.append(sum(l - f + 1 for f, l in segments[:len(starts)]))
+        for cp in range(first, last + 1):
+            g = glyphs.get(cp)
+            if g is None:
+                out.write('    {   0, 0, 0, 0, 0,  0 },   // %s, not in font\n' % char_name(cp))
+            else:
+                off = g.offset if g.width and g.height else 0
+                name = 'flag ' + g.flag if hasattr(g, 'flag') else char_name(cp)
+                out.write('    { %3d, %d, %d, %d, %d, %2d },   // %s\n' % (off, g.width, g.height, g.advance, g.xoff, g.yoff, name))
+    out.write('};\n\n')
+    return starts
+
+
+def font_segments(glyphs, gfxfont):
+    cps = sorted(glyphs)
+    if not cps:
+        sys.exit('no glyphs in sources')
+    if gfxfont:
+        if cps[-1] > 0xFFFF:
+            sys.exit('a plain GFXfont cannot hold codepoints above U+FFFF')
+        return [[cps[0], cps[-1]]]
+    return split_segments(cps)
+
+
+def write_header(fonts, sources, out, append=None):
+    """fonts: list of (name, glyphs, meta, gfxfont), all sharing the bitmap of the first one."""
+    base = fonts[0][0]
+    all_glyphs = [g for _, glyphs, _, _ in fonts for g in glyphs.values()]
+    bitmap = pack_bitmaps(all_glyphs)
+
+    out.write('// Bitmap font %s\n' % ', '.join(f[0] for f in fonts))
+    out.write('// Generated by tools/fontc.py from %s\n' % ', '.join(sources))
+    out.write('// WTFPL license applies\n\n#pragma once\n\n#include <Arduino.h>\n')
+    if not all(f[3] for f in fonts):
+        out.write('#include <utf832bitfont.h>\n')
+    if append:
+        out.write('#include <%s>\n' % append.split(':')[0].split('/')[-1])  # lib/gfx is on the include path
+    out.write('\ninline constexpr uint8_t %sBitmaps[] PROGMEM = {\n' % base)
+    for i in range(0, len(bitmap), 8):
+        row = bitmap[i:i + 8]
+        out.write('    %s,   // %d to %d\n' % (', '.join('0b{:08b}'.format(b) for b in row), i, i + len(row) - 1))
+    out.write('};\n\n')
+
+    flash = len(bitmap)
+    for name, glyphs, meta, gfxfont in fonts:
+        segments = font_segments(glyphs, gfxfont)
+        table = base + 'Glyphs' + name[len(base):] if name.startswith(base) else name + 'Glyphs'
+        starts = write_glyphs(out, table, glyphs, segments)
+        if gfxfont:
+            first, last = segments[0]
+            out.write('inline constexpr GFXfont %s PROGMEM = {\n    (uint8_t  *) %sBitmaps,\n    (GFXglyph *) %s,\n    %d, %d, %d\n};\n'
+                      % (name, base, table, first, last, meta['yadvance']))
+        else:
+            out.write('inline constexpr UTF8_32BitFont %s[] PROGMEM = {\n' % name)
+            for (first, last), start in zip(segments, starts):
+                narrow = last <= 0xFFFF
+                out.write('    {\n        (uint8_t  *) %sBitmaps,\n        (GFXglyph *) &%s[%d],\n' % (base, table, start))
+                out.write('        %d, %d, %d,\n' % (first if narrow else 0, last if narrow else 0, meta['yadvance']))
+                out.write('        %d, %d\n    },\n' % ((0, 0) if narrow else (first, last)))
+            if append and name == base:
+                out.write('    %s\n' % append.split(':')[1])
+            out.write('    {nullptr, nullptr, 0, 0, 0, 0, 0}\n};\n')
+        if name != fonts[-1][0]:
+            out.write('\n')
+
+        slots = sum(l - f + 1 for f, l in segments)
+        tables = slots * GLYPH_BYTES + (len(segments) + (0 if gfxfont else 1)) * SEGMENT_BYTES
+        flash += tables
+        sys.stderr.write('%s: %d glyphs in %d segments (%d empty slots), %d bytes of glyph and segment tables\n'
+                         % (name, len(glyphs), len(segments), slots - len(glyphs), tables))
+        sys.stderr.write('  lookup: lowest segment direct, others at most %d range compares (FontIndex bisection)\n'
+                         % math.ceil(math.log2(len(segments) + 1)))
+    raw = sum(len(g.packed()) for g in all_glyphs if g.width and g.height)
+    sys.stderr.write('bitmap %d bytes (%d before sharing), flash %d bytes, %.1f bytes per glyph\n'
+                     % (len(bitmap), raw, flash, flash / len(all_glyphs)))
+
+
+# ---- Sprite atlas ----
+
+def parse_atlas(path):
+    """Color pixel-art: "palette K RRGGBB" lines define the colors ('.' is transparent),
+    glyph headers as for fonts, rows made of palette keys."""
+    palette, glyphs, meta, current = ['.'], {}, {}, None
+    colors = {'.': (0, 0, 0)}
+    with open(path, encoding='utf-8') as f:
+        for lineno, raw in enumerate(f, 1):
+            line = raw.rstrip('\n')
+            if line.startswith('# ') or not line.strip():
+                current = None if not line.strip() else current
+                continue
+            words = line.split()
+            if words[0] == 'yadvance':
+                meta['yadvance'] = int(words[1])
+            elif words[0] == 'palette':
+                palette.append(words[1])
+                colors[words[1]] = tuple(int(words[2][k:k + 2], 16) for k in (0, 2, 4))
+            elif words[0].startswith('U+') or words[0] == 'flag':
+                fields = line.split(' #', 1)[0].split()
+                if fields[0] == 'flag':
+                    code = fields.pop(1).upper()
+                    if not re.fullmatch('[A-Z]{2}', code):
+                        sys.exit('%s:%d: flag needs a two letter code' % (path, lineno))
+                    cp = ('flag', code)
+                else:
+                    cp = int(fields[0][2:], 16)
+                kv = dict(item.split('=', 1) for item in fields[1:])
+                current = Glyph(cp, 0, 0, int(kv['advance']),
+                                int(kv.get('xoff', 0)), int(kv.get('yoff', 0)), [])
+                glyphs[current.cp] = current
+            elif current is not None and not set(line) - set(palette):
+                if current.rows and len(line) != len(current.rows[0]):
+                    sys.exit('%s:%d: rows of U+%04X differ in width' % (path, lineno, current.cp))
+                current.rows.append(line)
+                current.width, current.height = len(line), len(current.rows)
+            else:
+                sys.exit('%s:%d: unexpected line %r' % (path, lineno, line))
+    if len(palette) > 16:
+        sys.exit('%s: at most 15 colors besides transparent' % path)
+    meta.setdefault('yadvance', max(g.height for g in glyphs.values()) + 1)
+    return palette, colors, glyphs, meta
+
+
+def encode_sprite(g, palette):
+    pixels = [palette.index(ch) for row in g.rows for ch in row]
+    runs, k = [], 0
+    while k < len(pixels):
+        n = 1
+        while n < 16 and k + n < len(pixels) and pixels[k + n] == pixels[k]:
+            n += 1
+        runs.append(((n - 1) << 4) | pixels[k])
+        k += n
+    return runs
+
+
+def write_atlas(palette, colors, glyphs, meta, name, source, out):
+    flags = sorted(cp[1] for cp in glyphs if isinstance(cp, tuple))
+    for i, code in enumerate(flags):
+        g = glyphs.pop(('flag', code))
+        g.cp, g.flag = FLAG_FIRST + i, code
+        glyphs[g.cp] = g
+    cps = sorted(glyphs)
+    data, streams = [], {}
+    for cp in cps:
+        runs = tuple(encode_sprite(glyphs[cp], palette))
+        if runs not in streams:
+            streams[runs] = len(data)
+            data.extend(runs)
+        glyphs[cp].offset = streams[runs]
+    if len(data) > 0xFFFF:
+        sys.exit('sprite data of %d bytes does not fit 16-bit glyph offsets' % len(data))
+    segments = split_segments(cps)
+
+    out.write('// Sprite atlas %s\n' % name)
+    out.write('// Generated by tools/fontc.py from %s\n' % source)
+    out.write('// WTFPL license applies\n\n#pragma once\n\n#include <Arduino.h>\n#include <utf832bitfont.h>\n#include <sprite_atlas.h>\n')
+    if flags:
+        out.write('#include <grapheme_composer.h>\n')
+    out.write('\ninline constexpr uint8_t %sSprites[] PROGMEM = {\n' % name)
+    for i in range(0, len(data), 8):
+        row = data[i:i + 8]
+        out.write('    %s,   // %d to %d\n' % (', '.join('0x%02x' % b for b in row), i, i + len(row) - 1))
+    out.write('};\n\ninline constexpr uint8_t %sPalette[] PROGMEM = {\n' % name)
+    for key in palette:
+        out.write('    0x%02x, 0x%02x, 0x%02x,   // %s\n' % (colors[key] + ("'%s'%s" % (key, ', transparent' if key == '.' else ''),)))
+    out.write('};\n\n')
+    starts = write_glyphs(out, name + 'Glyphs', glyphs, segments)
+    out.write('inline constexpr SpriteAtlas %sAtlas = { %sSprites, %sPalette, %d };\n\n' % (name, name, name, len(palette)))
+    if flags:
+        letters = [0] * 26
+        for code in flags:
+            letters[ord(code[0]) - 65] |= 1 << (ord(code[1]) - 65)
+        index = [sum(bin(m).count('1') for m in letters[:a]) for a in range(26)]
+        out.write('// Flags %s, regional indicator pairs composed by GraphemeComposer\n' % ' '.join(flags))
+        out.write('inline constexpr uint8_t %sFlagIndex[26] PROGMEM = {\n    %s\n};\n\n' % (name, ', '.join(str(v) for v in index)))
+        out.write('inline constexpr uint32_t %sFlagLetters[26] PROGMEM = {\n' % name)
+        for a in range(0, 26, 8):
+            out.write('    %s,   // %s to %s\n' % (', '.join('0x%07x' % m for m in letters[a:a + 8]), chr(65 + a), chr(65 + min(a + 7, 25))))
+        out.write('};\n\ninline constexpr FlagTable %sFlags = { 0x%X, %sFlagIndex, %sFlagLetters };\n\n' % (name, FLAG_FIRST, name, name))
+    out.write('// Segments to be listed in a UTF8_32BitFont, so its text can hold the sprites inline\n')
+    out.write('#define %s_SEGMENTS \\\n' % name.upper())
+    for (first, last), start in zip(segments, starts):
+        narrow = last <= 0xFFFF
+        out.write('    { (uint8_t *) %sSprites, (GFXglyph *) &%sGlyphs[%d], %d, %d, %d, %d, %d }, \\\n'
+                  % (name, name, start, first if narrow else 0, last if narrow else 0, meta['yadvance'],
+                     0 if narrow else first, 0 if narrow else last))
+    out.write('\ninline constexpr UTF8_32BitFont %s[] PROGMEM = {\n    %s_SEGMENTS\n    {nullptr, nullptr, 0, 0, 0, 0, 0}\n};\n'
+              % (name, name.upper()))
+
+    raw = sum(g.width * g.height * 2 for g in glyphs.values())
+    slots = sum(l - f + 1 for f, l in segments)
+    flash = len(data) + 3 * len(palette) + slots * GLYPH_BYTES + (len(segments) + 1) * SEGMENT_BYTES
+    if flags:
+        flash += 26 * 5 + 12
+    sys.stderr.write('%s: %d sprites (%d flags) in %d segments, %d bytes of runs (%d as RGB565), flash %d bytes, %.1f bytes per sprite\n'
+                     % (name, len(cps), len(flags), len(segments), len(data), raw, flash, flash / len(cps)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().split('\n')[0])
+    sub = ap.add_subparsers(dest='cmd', required=True)
+    b = sub.add_parser('build', help='compile sources into a font header')
+    b.add_argument('sources', nargs='+')
+    b.add_argument('--name', required=True)
+    b.add_argument('--gfxfont', action='store_true', help='emit a plain single-segment GFXfont')
+    b.add_argument('--share', action='append', default=[], metavar='NAME=SOURCE[,SOURCE...]',
+                   help='another plain GFXfont built into the same bitmap array')
+    b.add_argument('-o', '--output')
+    b.add_argument('--append-segments', metavar='HEADER:MACRO',
+                   help='list segments of a sprite atlas (or another font) at the end of the font')
+    a = sub.add_parser('atlas', help='compile color pixel-art into a sprite atlas')
+    a.add_argument('source')
+    a.add_argument('--name', required=True)
+    a.add_argument('-o', '--output')
+    i = sub.add_parser('import', help='convert a font header into pixel-art source')
+    i.add_argument('header')
+    i.add_argument('--font', required=True)
+    args = ap.parse_args()
+
+    if args.cmd == 'import':
+        glyphs, meta = parse_header(args.header, args.font)
+        write_source(glyphs, meta, sys.stdout)
+    elif args.cmd == 'atlas':
+        out = open(args.output, 'w', encoding='utf-8') if args.output else sys.stdout
+        write_atlas(*parse_atlas(args.source), args.name, args.source.split('/')[-1], out)
+    else:
+        fonts = [(args.name, *load_sources(args.sources), args.gfxfont)]
+        sources = list(args.sources)
+        for share in args.share:
+            name, paths = share.split('=', 1)
+            fonts.append((name, *load_sources(paths.split(',')), True))
+            sources += paths.split(',')
+        out = open(args.output, 'w', encoding='utf-8') if args.output else sys.stdout
+        write_header(fonts, [s.split('/')[-1] for s in sources], out, args.append_segments)
+
+
+if __name__ == '__main__':
+    main()